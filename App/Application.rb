@@ -5,9 +5,12 @@ require_relative 'Threads'
 require_relative 'Breakpoints'
 require_relative 'Project'
 require_relative 'Values'
+require_relative 'Memory'
+require_relative 'Watches'
 require_relative 'Editors'
 require_relative 'ProcessSelector'
 require_relative 'ModuleExplorer'
+require_relative 'SymbolSearch'
 require_relative 'Utils'
 
 module App
@@ -39,10 +42,13 @@ module App
       @callStack = App::CallStack.new(@mainwindow, @debugger)
       @threads = App::Threads.new(@mainwindow, @debugger)
       @values = App::Values.new(@mainwindow, @debugger)
+      @memory = App::Memory.new(@mainwindow, @debugger)
+      @watches = App::Watches.new(@mainwindow, @debugger, @project)
       @breakpoints = App::Breakpoints.new(@mainwindow, @debugger, @project)
       @console = App::Console.new(@mainwindow, @debugger)
+      @symbolSearch = App::SymbolSearch.new(@mainwindow, @debugger)
       @log.console = @console
-      @processWindows = [ @threads, @callStack, @values ]
+      @processWindows = [ @threads, @callStack, @values, @memory ]
 
       buildToolbars()
       buildMenus()
@@ -109,6 +115,9 @@ module App
           @debugger.connect("connect://" + dlg.value("url"))
         end
       })
+      @targetToolbar.addAction("Go To Symbol", Proc.new {
+        @symbolSearch.show()
+      })
 
       @processToolbar = @mainwindow.addToolBar("Process")
       @processToolbar.addAction("Kill", Proc.new {
@@ -166,7 +175,7 @@ module App
 
     def onTargetChanged(t)
       if (t != nil)
-        t.breakpointsChanged.listen { |_| @editors.syncEditorBreakpoints() }
+        t.breakpointsChanged.listen { |change| @editors.breakpointChanged(change) }
         @targetToolbar.show()
       else
         @targetToolbar.hide()
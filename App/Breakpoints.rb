@@ -22,15 +22,35 @@ module App
         dlg.setValue("line", oldLoc.line)
       end
 
+      if (oldBr)
+        dlg.setValue("condition", oldBr.condition)
+        dlg.setValue("ignoreCount", oldBr.ignoreCount)
+        dlg.setValue("logMessage", oldBr.logMessage)
+      end
+
       dlg.exec()
       if (UI::Dialog::Result[dlg.result()] == :Accepted)
-        target.addBreakpoint(dlg.value("file"), dlg.value("line").to_i)
+        br = target.addBreakpoint(dlg.value("file"), dlg.value("line").to_i)
+        BreakpointEditor.applyOptions(br, dlg.value("condition"), dlg.value("ignoreCount").to_i, dlg.value("logMessage"))
 
         if (oldBr != nil)
           target.removeBreakpoint(oldBr)
         end
+
+        # Options are set after the breakpoint was added, flush them through to the views.
+        target.processEvents()
       end
     end
+
+    def self.applyOptions(br, condition, ignoreCount, logMessage)
+      if (br == nil)
+        return
+      end
+
+      br.setCondition(condition) if (condition && condition.length > 0)
+      br.setIgnoreCount(ignoreCount) if (ignoreCount && ignoreCount > 0)
+      br.setLogMessage(logMessage) if (logMessage && logMessage.length > 0)
+    end
   end
 
   class Breakpoints
@@ -47,10 +67,12 @@ module App
 
       project.install_handler(:breakpoints, self)
 
+      @rows = { }
       @debugger.targetChanged.listen do |t|
         if (t)
-          t.breakpointsChanged.listen { |_| updateBreakpoints() }
+          t.breakpointsChanged.listen { |change| breakpointChanged(change) }
         end
+        updateBreakpoints()
       end
 
       @widget.clicked.listen do |f|
@@ -78,15 +100,28 @@ module App
     end
 
     def updateBreakpoints()
+      @rows = { }
       target = @debugger.target
-      if (target == nil)
-        @widget.setContents("")
-        return
+      if (target != nil)
+        target.breakpoints.each { |b| @rows[b.id] = formatBreakpoint(b) }
       end
 
-      breakpoints = target.breakpoints.map { |b| formatBreakpoint(b) }
+      showRows()
+    end
 
-      @widget.setContents(alternatingColourList(breakpoints))
+    def breakpointChanged(change)
+      id = change.breakpoint
+      if (Debugify::BreakpointChange::Type[change.type] == :Removed)
+        @rows.delete(id)
+      else
+        @rows[id] = formatBreakpoint(@debugger.target.breakpointWithId(id))
+      end
+
+      showRows()
+    end
+
+    def showRows()
+      @widget.setContents(alternatingColourList(@rows.values))
     end
 
     def formatBreakpoint(b)
@@ -97,6 +132,18 @@ module App
         loc << "#{file} #{l.line}"
       end
 
+      if (b.condition.length > 0)
+        loc << " if #{b.condition}"
+      end
+
+      if (b.logMessage.length > 0)
+        loc << " log \"#{b.logMessage}\""
+      end
+
+      if (b.hitCount > 0)
+        loc << " (hit #{b.hitCount})"
+      end
+
       col = b.enabled ? :black : :darkgray
       link(b.id, colour(loc, col))
     end
@@ -111,7 +158,8 @@ module App
         brks = handler.value(:breakpoints)
         brks.each do |b|
           if (b.include?("file") && b.include?("line"))
-            @debugger.target.addBreakpoint(b["file"], b["line"])
+            br = @debugger.target.addBreakpoint(b["file"], b["line"])
+            BreakpointEditor.applyOptions(br, b["condition"], b["ignoreCount"], b["logMessage"])
           end
         end
       end
@@ -121,13 +169,14 @@ module App
       brks = []
       target = @debugger.target
       if (target != nil)
-        brk = { }
-        brks << brk
         target.breakpoints.each do |b|
-          if (b.locations.length)
+          if (b.locations.length > 0)
             l = b.locations[0]
-            brk["file"] = l.file
-            brk["line"] = l.line
+            brk = { "file" => l.file, "line" => l.line }
+            brk["condition"] = b.condition if (b.condition.length > 0)
+            brk["ignoreCount"] = b.ignoreCount if (b.ignoreCount > 0)
+            brk["logMessage"] = b.logMessage if (b.logMessage.length > 0)
+            brks << brk
           end
         end
       end
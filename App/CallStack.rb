@@ -11,20 +11,23 @@ module App
       @widget = mainWindow.addEditor("Call Stack", false)
 
       @widget.clicked.listen do |f, x, y|
-        thread = mainWindow.process.selectedThread
-
-        newFrame = thread.frames[f.to_i]
-        thread.selectFrame(newFrame)
+        process = mainWindow.process
+        snapshot = process ? process.stopSnapshot : nil
+        thread = snapshot ? snapshot.selectedThread : 0
+        frame = f.to_i
+        if (snapshot && thread < snapshot.threadCount && frame < snapshot.frameCount(thread))
+          snapshot.thread(thread).selectFrame(snapshot.frame(thread, frame))
+        end
         debugger.update()
       end
 
       debugger.ready.listen do |process|
-        thread = mainWindow.process.selectedThread
-        frames = thread.frames
-
-        frameStrings = frames.map { |t| formatFrame(t) }
-        selected = frames.find_index { |t| t.isCurrent }
-        @widget.setContents(alternatingColourList(frameStrings, { :selected => selected }))
+        snapshot = mainWindow.process.stopSnapshot
+        thread = snapshot ? snapshot.selectedThread : 0
+        if (snapshot && thread < snapshot.threadCount)
+          frameStrings = snapshot.frameCount(thread).times.map { |i| formatFrame(snapshot, thread, i) }
+          @widget.setContents(alternatingColourList(frameStrings, { :selected => snapshot.selectedFrame(thread) }))
+        end
       end
 
       debugger.running.listen do |process|
@@ -32,13 +35,13 @@ module App
       end
     end
 
-    def formatFrame(frame)
+    def formatFrame(snapshot, thread, i)
       lineData = nil
-      if (frame.hasLineNumber)
-        lineData = "line #{frame.lineNumber}"
+      if (snapshot.hasLineNumber(thread, i))
+        lineData = "line #{snapshot.lineNumber(thread, i)}"
       end
 
-      return link(frame.id, "#{frame.functionName} #{lineData}")
+      return link(i, "#{snapshot.functionName(thread, i)} #{lineData}")
     end
 
   end
@@ -13,6 +13,11 @@ module App
           @widget.clear()
         end
       end
+
+      @widget.input.listen do |inp|
+        process = debugger.process
+        process.writeInput(inp + "\n") if process
+      end
     end
 
     def append(s)
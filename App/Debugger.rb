@@ -67,6 +67,10 @@ module App
     def launch(args = [], env = [])
       err = LldbDriver::Error.new()
       raise "No target to launch" unless @target
+
+      # Pipes or Pty have Debugify read the process' output itself, for programs writing a lot of it.
+      mode = LldbDriver::StdioMode[@project.value(:stdio, "Debugger").to_sym]
+      @target.setStdioMode(mode || LldbDriver::StdioMode[:Debugger])
       return setupProcess(@target.launch(args, env, err), err)
     end
 
@@ -154,6 +158,7 @@ module App
 
         @process.outputAvailable.listen{ syncOutputs() }
         @process.errorAvailable.listen{ syncOutputs() }
+        @process.breakpointLogAvailable.listen{ syncBreakpointLog() }
       else
         @processEnd.call(p)
       end
@@ -163,7 +168,9 @@ module App
       if (state == Debugify::ProcessState[:Stopped])
         @isReady = true
 
-        @process.threads.each do |t|
+        snapshot = @process.stopSnapshot
+        snapshot.threadCount.times do |i|
+          t = snapshot.thread(i)
           reason = Debugify::Thread::StopReason[t.stopReason()]
           if (reason != :None)
             @log.log("Thread 0x#{t.id.to_s(16)} stopped with #{reason}")
@@ -202,6 +209,11 @@ module App
       @log.log(err) if err.length > 0
       @log.log(out) if out.length > 0
     end
+
+    def syncBreakpointLog()
+      log = @target.takeBreakpointLog()
+      @log.log(log.chomp) if log.length > 0
+    end
   end
 
 end
\ No newline at end of file
@@ -56,26 +56,32 @@ module App
     end
 
     def syncEditorBreakpoints()
-      @editors.each do |_, e|
-        if (e.is_a? UI::FileEditor)
-          e.clearMarkers(UI::FileEditor::MarkerType[:Breakpoint]) 
-        end
+      @editors.each do |path, e|
+        syncBreakpointMarkers(path, e)
       end
+    end
 
-      target = @debugger.target
-      target.breakpoints.each do |br|
-        br.locations.each do |l|
-          addEditorBreakpoint(l.file, l.line)
-        end
+    def breakpointChanged(change)
+      change.files.each do |f|
+        editor = @editors[f]
+        syncBreakpointMarkers(f, editor) if editor
       end
     end
 
     def loadCurrentSource(process)
-      thread = process.selectedThread
-      frame = thread.selectedFrame
+      snapshot = process.stopSnapshot
+      thread = snapshot ? snapshot.selectedThread : 0
+      if (snapshot == nil || thread >= snapshot.threadCount)
+        return
+      end
 
-      file = frame.filename
-      line = frame.lineNumber
+      frame = snapshot.selectedFrame(thread)
+      if (frame >= snapshot.frameCount(thread))
+        return
+      end
+
+      file = snapshot.filename(thread, frame)
+      line = snapshot.lineNumber(thread, frame)
       if (file.length > 0)
         editor = @mainwindow.openFile(file, line)
       end
@@ -90,33 +96,47 @@ module App
     end
 
     def highlightSources()
-      clearSourceHighlight()
-
-      if (@mainwindow.process == nil)
-        return
-      end
-      
-      @mainwindow.process.threads.each do |t|
-        frame = t.selectedFrame
-
-        if (frame.hasLineNumber)
-          current = t.isCurrent
-
-          line = frame.lineNumber
-          file =  frame.filename
-
-          editor = @editors[file]
-          if (editor)
-            @activeEditors << editor
-            type = current ? UI::FileEditor::MarkerType[:CurrentLine] :
-              UI::FileEditor::MarkerType[:ActiveLine]
-            editor.addMarker(type, line)
+      # Gather every thread's line first, so each editor is only updated once.
+      markers = { }
+      @activeEditors.each { |e| markers[e] = { :ActiveLine => [], :CurrentLine => [] } }
+
+      process = @mainwindow.process
+      snapshot = process ? process.stopSnapshot : nil
+      if (snapshot != nil)
+        snapshot.threadCount.times do |t|
+          frame = snapshot.selectedFrame(t)
+
+          if (frame < snapshot.frameCount(t) && snapshot.hasLineNumber(t, frame))
+            current = t == snapshot.selectedThread
+
+            line = snapshot.lineNumber(t, frame)
+            file = snapshot.filename(t, frame)
+
+            editor = @editors[file]
+            if (editor)
+              lines = (markers[editor] ||= { :ActiveLine => [], :CurrentLine => [] })
+              lines[current ? :CurrentLine : :ActiveLine] << line
+            end
           end
         end
       end
+
+      @activeEditors.clear()
+      markers.each do |editor, lines|
+        lines.each { |type, l| editor.setMarkers(UI::FileEditor::MarkerType[type], l) }
+        @activeEditors << editor if (lines.any? { |type, l| l.length > 0 })
+      end
     end
 
   private
+    def syncBreakpointMarkers(path, editor)
+      if (!editor.is_a?(UI::FileEditor))
+        return
+      end
+
+      editor.setMarkers(UI::FileEditor::MarkerType[:Breakpoint], @debugger.target.breakpointLines(path))
+    end
+
     def typeDiscovered(type)
       if (@pendingTypes.delete?(type) != nil)
         raise "Failed to open #{type}" unless @mainwindow.openType(type)
@@ -133,6 +153,7 @@ module App
 
     def destroyEditor(editor)
       @editors.delete(editor.path)
+      @activeEditors.delete(editor)
     end
 
     def setupFileEditor(editor)
@@ -149,12 +170,6 @@ module App
       highlightSources()
       syncEditorBreakpoints()
     end
-
-    def addEditorBreakpoint(file, line)
-      editor = @editors[file]
-
-      editor.addMarker(UI::FileEditor::MarkerType[:Breakpoint], line) if editor
-    end
   end
 
 end
\ No newline at end of file
@@ -0,0 +1,19 @@
+module App
+
+  class Memory
+    attr_reader :widget
+
+    def initialize(mainWindow, debugger)
+      @widget = mainWindow.addMemoryView("Memory", false)
+
+      # The process drops its cached memory when it resumes, so the view reads it afresh at each stop.
+      debugger.ready.listen do |process|
+        @widget.setProcess(mainWindow.process)
+      end
+
+      debugger.processEnd.listen do |process|
+        @widget.clear()
+      end
+    end
+  end
+end
@@ -0,0 +1,78 @@
+module App
+
+  class SymbolSearch
+    MaxResults = 100
+
+    def initialize(mainwindow, debugger)
+      @mainwindow = mainwindow
+
+      # Shared libraries are loaded after launch, pick them up each time the process stops.
+      debugger.ready.listen do |p|
+        index = @mainwindow.symbolIndex
+        if (index)
+          index.refresh()
+        end
+      end
+    end
+
+    def show()
+      @index = @mainwindow.symbolIndex
+      if (@index == nil)
+        return
+      end
+      @index.refresh()
+
+      dlg = UI::Dialog.new(UI::UIC_PATH + "gotosymbol.ui")
+
+      matches = { }
+      dlg.changed.listen do |p|
+        if (p == "query")
+          matches = search(dlg.value("query"))
+          dlg.setAvailableValues("symbols", matches.keys)
+          if (matches.length > 0)
+            dlg.setValue("symbols", matches.keys[0])
+          end
+        end
+      end
+
+      dlg.exec()
+      if (UI::Dialog::Result[dlg.result()] != :Accepted)
+        return
+      end
+
+      match = matches[dlg.value("symbols")]
+      if (match)
+        open(match)
+      end
+    end
+
+  private
+    def search(query)
+      results = { }
+      @index.find(query, MaxResults).each do |m|
+        results[describe(m)] ||= m
+      end
+      return results
+    end
+
+    def describe(match)
+      location = File.basename(match.modulePath)
+      if (match.hasLineNumber)
+        location = "#{File.basename(match.filename)}:#{match.lineNumber}"
+      end
+
+      return "#{match.name} (#{location})"
+    end
+
+    def open(match)
+      if (match.isType && @mainwindow.openType(match.name) != nil)
+        return
+      end
+
+      if (match.hasLineNumber)
+        @mainwindow.openFile(match.filename, match.lineNumber)
+      end
+    end
+  end
+
+end
@@ -12,19 +12,26 @@ module App
       @widget = mainWindow.addEditor("Threads", false)
 
       @widget.clicked.listen do |p, x, y|
-        threadList = mainWindow.process.threads
-        selected = threadList.find do |t| 
-          next t.id == p.to_i
+        process = mainWindow.process
+        snapshot = process ? process.stopSnapshot : nil
+        index = nil
+        if (snapshot)
+          index = snapshot.threadCount.times.find do |i|
+            next snapshot.threadID(i) == p.to_i
+          end
+        end
+        if (index != nil)
+          process.selectThread(snapshot.thread(index))
         end
-        mainWindow.process.selectThread(selected)
         debugger.update()
       end
 
       debugger.ready.listen do |process|
-        threadList = mainWindow.process.threads
-        threadStrings = threadList.map { |t| formatThread(t) }
-        selected = threadList.find_index { |t| t.isCurrent }
-        @widget.setContents(alternatingColourList(threadStrings, { :selected => selected }))
+        snapshot = mainWindow.process.stopSnapshot
+        if (snapshot)
+          threadStrings = snapshot.threadCount.times.map { |i| formatThread(snapshot, i) }
+          @widget.setContents(alternatingColourList(threadStrings, { :selected => snapshot.selectedThread }))
+        end
       end
 
       debugger.running.listen do |process|
@@ -32,14 +39,18 @@ module App
       end
     end
 
-    def formatThread(t)
-      frameTop = t.frames[0]
+    def formatThread(snapshot, i)
+      id = snapshot.threadID(i)
+      functionName = nil
       lineData = nil
-      if (frameTop.hasLineNumber)
-        lineData = "line #{frameTop.lineNumber}"
+      if (snapshot.frameCount(i) > 0)
+        functionName = snapshot.functionName(i, 0)
+        if (snapshot.hasLineNumber(i, 0))
+          lineData = "line #{snapshot.lineNumber(i, 0)}"
+        end
       end
 
-      return link(t.id, "0x#{t.id.to_s(16)} #{t.name()} #{frameTop.functionName} #{lineData}")
+      return link(id, "0x#{id.to_s(16)} #{snapshot.threadName(i)} #{functionName} #{lineData}")
     end
   end
 
@@ -1,53 +1,32 @@
-require_relative 'TextWindow'
-
 module App
 
   class Values
-    include TextWindow
-
     attr_reader :widget
     
     def initialize(mainWindow, debugger)
-      @widget = mainWindow.addEditor("Values", false)
+      @widget = mainWindow.addValueTree("Values", false)
 
       debugger.ready.listen do |process|
-        thread = mainWindow.process.selectedThread
-        if (thread)
-          frame = thread.selectedFrame
-          if (frame)
-            updateValues(frame)
+        @widget.setRunning(false)
+        snapshot = mainWindow.process.stopSnapshot
+        thread = snapshot ? snapshot.selectedThread : 0
+        if (snapshot && thread < snapshot.threadCount)
+          frame = snapshot.selectedFrame(thread)
+          if (frame < snapshot.frameCount(thread))
+            @widget.setFrame(snapshot.frame(thread, frame))
           end
         end
       end
 
+      # Values are kept while running, so the next stop in the same frame only updates what changed.
       debugger.notReady.listen do |process|
-        @widget.setContents("")
+        @widget.setRunning(true)
       end
-    end
-
-    def updateValues(frame)
-      values = []
-
-      frame.arguments().map { |v| formatValue(:argument, v, values) }
-      frame.locals().map { |v| formatValue(:local, v, values) }
 
-      @widget.setContents(alternatingColourList(values))
-    end
-
-    Types = { :argument => "A", :local => "L", :child => " "}
-
-    def formatValue(type, v, values, depth = 0)
-      tStr = Types[type]
-      children = v.mightHaveChildren
-      start = children ? "+" : " "
-      
-      values << "#{'&nbsp;' * 2 * depth}#{start} #{tStr} #{v.name} #{v.type.name}(#{v.value})"
-
-      if (children)
-        v.children.each do |c|
-          formatValue(:child, c, values, depth + 1)
-        end
+      debugger.processEnd.listen do |process|
+        @widget.setRunning(false)
+        @widget.clear()
       end
     end
   end
-end
\ No newline at end of file
+end
@@ -0,0 +1,57 @@
+module App
+
+  class Watches
+    attr_reader :widget
+
+    def initialize(mainWindow, debugger, project)
+      @widget = mainWindow.addWatches("Watches", false)
+
+      # Watches are evaluated off the gui thread, each row filling in as its result arrives.
+      debugger.ready.listen do |process|
+        snapshot = mainWindow.process.stopSnapshot
+        thread = snapshot ? snapshot.selectedThread : 0
+        if (snapshot && thread < snapshot.threadCount)
+          frame = snapshot.selectedFrame(thread)
+          if (frame < snapshot.frameCount(thread))
+            @widget.evaluate(snapshot.frame(thread, frame))
+          end
+        end
+      end
+
+      debugger.notReady.listen do |process|
+        @widget.setRunning(true)
+      end
+
+      debugger.processEnd.listen do |process|
+        @widget.clear()
+      end
+
+      project.install_handler(:watches, self)
+    end
+
+    def owns_value(id)
+      return id.to_sym == :watches
+    end
+
+    def deserialise(handler)
+      # Called again each time a target is loaded, with that executable's watches.
+      @widget.clearWatches()
+      if (handler.has_value(:watches))
+        handler.value(:watches).each do |w|
+          @widget.addWatch(w)
+        end
+      end
+    end
+
+    def serialise(handler)
+      watches = []
+      @widget.watchCount.times do |i|
+        watches << @widget.watchExpression(i)
+      end
+
+      if (handler.has_location(:exe))
+        handler.set_value(:watches, watches, :exe)
+      end
+    end
+  end
+end
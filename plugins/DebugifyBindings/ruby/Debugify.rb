@@ -26,6 +26,38 @@ class EnumerationWrapper
 end
 
 
+# Enumerates a sequence a page at a time, so each page is one call into the driver.
+class PagedEnumerationWrapper
+  include Enumerable
+
+  PageSize = 128
+
+  def initialize(countFn, pageFn)
+    @count = countFn
+    @page = pageFn
+  end
+
+  def length
+    return @count.call()
+  end
+
+  def [](i)
+    @page.call(i, 1)[0]
+  end
+
+  def each
+    total = length
+    start = 0
+    while start < total
+      @page.call(start, PageSize).each do |v|
+        yield(v)
+      end
+      start += PageSize
+    end
+  end
+end
+
+
 NotifierExtensions.install([
   ProcessStateChangeNotifier,
   NoArgNotifier,
@@ -42,12 +74,26 @@ def self.addEnumerator(cls, nameSym, countSym, atSym)
   end
 end
 
+# Replaces [nameSym] with a method that pages through the original when called with no arguments.
+def self.addPagedEnumerator(cls, nameSym, countSym)
+
+  count = cls.instance_method(countSym)
+  page = cls.instance_method(nameSym)
+
+  cls.send(:define_method, nameSym) do |*args|
+    if (args.empty?)
+      return PagedEnumerationWrapper.new(count.bind(self), page.bind(self))
+    end
+    return page.bind(self).call(*args)
+  end
+end
+
 addEnumerator(Target, :modules, :moduleCount, :moduleAt)
 addEnumerator(Target, :breakpoints, :breakpointCount, :breakpointAt)
 addEnumerator(Process, :threads, :threadCount, :threadAt)
 addEnumerator(Thread, :frames, :frameCount, :frameAt)
 addEnumerator(Breakpoint, :locations, :locationCount, :locationAt)
-addEnumerator(Value, :children, :childCount, :childAt)
+addPagedEnumerator(Value, :children, :childCount)
 
 end
 
@@ -20,6 +20,17 @@ require_relative 'Module'
 require_relative 'Breakpoint'
 require_relative 'BreakpointLocation'
 require_relative 'Target'
+require_relative 'StopSnapshot'
+require_relative 'ValueSummary'
+require_relative 'SymbolIndex'
+require_relative 'SymbolMatch'
+require_relative 'BreakpointChange'
+require_relative 'FrameValues'
+require_relative 'ArrayStatistics'
+require_relative 'Evaluator'
+require_relative 'Evaluation'
+require_relative 'WatchSet'
+require_relative 'WatchResult'
 
 module LldbDriver
 ProcessState = Enum.new({
@@ -36,6 +47,24 @@ ProcessState = Enum.new({
   :Exited => 10,
   :Suspended => 11,
 })
+StdioMode = Enum.new({
+  :Debugger => 0,
+  :Pipes => 1,
+  :Pty => 2,
+})
+
+EvaluationPolicy = Enum.new({
+  :VariablesOnly => 0,
+  :RunTarget => 1,
+})
+
+EvaluationMethod = Enum.new({
+  :None => 0,
+  :Cached => 1,
+  :VariablePath => 2,
+  :Expression => 3,
+  :Failed => 4,
+})
 
 end
 
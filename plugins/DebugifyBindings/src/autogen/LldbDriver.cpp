@@ -17,6 +17,12 @@
 #include "Error.h"
 #include "../../../Eks/EksCore/include/Containers/XVector.h"
 #include "../../../Eks/EksCore/include/Memory/XTypedAllocator.h"
+#include "StopSnapshot.h"
+#include "SymbolIndex.h"
+#include "Target.h"
+#include "FrameValues.h"
+#include "Evaluator.h"
+#include "WatchSet.h"
 
 
 using namespace LldbDriver;
@@ -98,7 +104,7 @@ BONDAGE_IMPLEMENT_EXPOSED_CLASS(
 
 
 // Exposing class ::LldbDriver::BreakpointNotifier
-struct LldbDriver_BreakpointNotifier_listen_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< int(::LldbDriver::BreakpointNotifier::*)(std::function<void ()> &&) >, &::LldbDriver::BreakpointNotifier::listen, bondage::FunctionCaller> { };
+struct LldbDriver_BreakpointNotifier_listen_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< int(::LldbDriver::BreakpointNotifier::*)(std::function<void (const BreakpointChange &)> &&) >, &::LldbDriver::BreakpointNotifier::listen, bondage::FunctionCaller> { };
 struct LldbDriver_BreakpointNotifier_remove_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::LldbDriver::BreakpointNotifier::*)(int) >, &::LldbDriver::BreakpointNotifier::remove, bondage::FunctionCaller> { };
 
 const bondage::Function LldbDriver_BreakpointNotifier_methods[] = {
@@ -131,6 +137,7 @@ std::tuple< Eks::String, Eks::String > LldbDriver_Process_getOutputs_overload0(:
   return result;
 }
 
+struct LldbDriver_Process_breakpointLogAvailable_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::NoArgNotifier *(::LldbDriver::Process::*)() >, &::LldbDriver::Process::breakpointLogAvailable, bondage::FunctionCaller> { };
 struct LldbDriver_Process_continueExecution_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::Error(::LldbDriver::Process::*)() >, &::LldbDriver::Process::continueExecution, bondage::FunctionCaller> { };
 struct LldbDriver_Process_currentState_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::ProcessState(::LldbDriver::Process::*)() const >, &::LldbDriver::Process::currentState, bondage::FunctionCaller> { };
 struct LldbDriver_Process_ended_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::NoArgNotifier *(::LldbDriver::Process::*)() >, &::LldbDriver::Process::ended, bondage::FunctionCaller> { };
@@ -144,14 +151,20 @@ struct LldbDriver_Process_outputAvailable_overload0_t : Reflect::FunctionCall<Re
 struct LldbDriver_Process_pauseExecution_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::Error(::LldbDriver::Process::*)() >, &::LldbDriver::Process::pauseExecution, bondage::FunctionCaller> { };
 struct LldbDriver_Process_processEvents_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::LldbDriver::Process::*)() >, &::LldbDriver::Process::processEvents, bondage::FunctionCaller> { };
 struct LldbDriver_Process_processID_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::Process::*)() const >, &::LldbDriver::Process::processID, bondage::FunctionCaller> { };
+struct LldbDriver_Process_readMemory_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::Vector<uint8_t>(::LldbDriver::Process::*)(uint64_t, size_t) >, &::LldbDriver::Process::readMemory, bondage::FunctionCaller> { };
 struct LldbDriver_Process_selectThread_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::LldbDriver::Process::*)(const std::shared_ptr<Thread> &) >, &::LldbDriver::Process::selectThread, bondage::FunctionCaller> { };
 struct LldbDriver_Process_selectedThread_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< std::shared_ptr<Thread>(::LldbDriver::Process::*)() >, &::LldbDriver::Process::selectedThread, bondage::FunctionCaller> { };
 struct LldbDriver_Process_stateChanged_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::ProcessStateChangeNotifier *(::LldbDriver::Process::*)() >, &::LldbDriver::Process::stateChanged, bondage::FunctionCaller> { };
+struct LldbDriver_Process_stopSnapshot_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< std::shared_ptr<StopSnapshot>(::LldbDriver::Process::*)() >, &::LldbDriver::Process::stopSnapshot, bondage::FunctionCaller> { };
 struct LldbDriver_Process_target_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< std::shared_ptr<Target>(::LldbDriver::Process::*)() >, &::LldbDriver::Process::target, bondage::FunctionCaller> { };
 struct LldbDriver_Process_threadAt_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< std::shared_ptr<Thread>(::LldbDriver::Process::*)(size_t) >, &::LldbDriver::Process::threadAt, bondage::FunctionCaller> { };
 struct LldbDriver_Process_threadCount_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::Process::*)() >, &::LldbDriver::Process::threadCount, bondage::FunctionCaller> { };
+struct LldbDriver_Process_writeInput_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::LldbDriver::Process::*)(const Eks::String &) >, &::LldbDriver::Process::writeInput, bondage::FunctionCaller> { };
 
 const bondage::Function LldbDriver_Process_methods[] = {
+  bondage::FunctionBuilder::build<
+    LldbDriver_Process_breakpointLogAvailable_overload0_t
+    >("breakpointLogAvailable"),
   bondage::FunctionBuilder::build<
     LldbDriver_Process_continueExecution_overload0_t
     >("continueExecution"),
@@ -191,6 +204,9 @@ const bondage::Function LldbDriver_Process_methods[] = {
   bondage::FunctionBuilder::build<
     LldbDriver_Process_processID_overload0_t
     >("processID"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Process_readMemory_overload0_t
+    >("readMemory"),
   bondage::FunctionBuilder::build<
     LldbDriver_Process_selectThread_overload0_t
     >("selectThread"),
@@ -200,6 +216,9 @@ const bondage::Function LldbDriver_Process_methods[] = {
   bondage::FunctionBuilder::build<
     LldbDriver_Process_stateChanged_overload0_t
     >("stateChanged"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Process_stopSnapshot_overload0_t
+    >("stopSnapshot"),
   bondage::FunctionBuilder::build<
     LldbDriver_Process_target_overload0_t
     >("target"),
@@ -208,7 +227,10 @@ const bondage::Function LldbDriver_Process_methods[] = {
     >("threadAt"),
   bondage::FunctionBuilder::build<
     LldbDriver_Process_threadCount_overload0_t
-    >("threadCount")
+    >("threadCount"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Process_writeInput_overload0_t
+    >("writeInput")
 };
 
 
@@ -219,7 +241,7 @@ BONDAGE_IMPLEMENT_EXPOSED_CLASS(
   Process,
   void,
   LldbDriver_Process_methods,
-  19);
+  23);
 
 
 
@@ -491,17 +513,22 @@ BONDAGE_IMPLEMENT_EXPOSED_CLASS(
 
 // Exposing class ::LldbDriver::Value
 struct LldbDriver_Value_address_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::Value(::LldbDriver::Value::*)() const >, &::LldbDriver::Value::address, bondage::FunctionCaller> { };
+struct LldbDriver_Value_asArray_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::Value(::LldbDriver::Value::*)(size_t) const >, &::LldbDriver::Value::asArray, bondage::FunctionCaller> { };
 struct LldbDriver_Value_changed_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< bool(::LldbDriver::Value::*)() const >, &::LldbDriver::Value::changed, bondage::FunctionCaller> { };
 struct LldbDriver_Value_childAt_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::Value(::LldbDriver::Value::*)(size_t) const >, &::LldbDriver::Value::childAt, bondage::FunctionCaller> { };
 struct LldbDriver_Value_childCount_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::Value::*)() const >, &::LldbDriver::Value::childCount, bondage::FunctionCaller> { };
+struct LldbDriver_Value_children_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::Vector<Value>(::LldbDriver::Value::*)(size_t, size_t) const >, &::LldbDriver::Value::children, bondage::FunctionCaller> { };
 struct LldbDriver_Value_dereference_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::Value(::LldbDriver::Value::*)() const >, &::LldbDriver::Value::dereference, bondage::FunctionCaller> { };
 struct LldbDriver_Value_evaluate_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::Value(::LldbDriver::Value::*)(const char *, const char *) const >, &::LldbDriver::Value::evaluate, bondage::FunctionCaller> { };
 struct LldbDriver_Value_evaluateChild_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::Value(::LldbDriver::Value::*)(const char *) const >, &::LldbDriver::Value::evaluateChild, bondage::FunctionCaller> { };
 struct LldbDriver_Value_inScope_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< bool(::LldbDriver::Value::*)() const >, &::LldbDriver::Value::inScope, bondage::FunctionCaller> { };
+struct LldbDriver_Value_isContiguousArray_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< bool(::LldbDriver::Value::*)() const >, &::LldbDriver::Value::isContiguousArray, bondage::FunctionCaller> { };
 struct LldbDriver_Value_isPointerType_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< bool(::LldbDriver::Value::*)() const >, &::LldbDriver::Value::isPointerType, bondage::FunctionCaller> { };
 struct LldbDriver_Value_mightHaveChildren_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< bool(::LldbDriver::Value::*)() const >, &::LldbDriver::Value::mightHaveChildren, bondage::FunctionCaller> { };
 struct LldbDriver_Value_name_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::String(::LldbDriver::Value::*)() const >, &::LldbDriver::Value::name, bondage::FunctionCaller> { };
 struct LldbDriver_Value_operatore_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::Value &(::LldbDriver::Value::*)(const LldbDriver::Value &) >, &::LldbDriver::Value::operator=, bondage::FunctionCaller> { };
+struct LldbDriver_Value_statistics_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::ArrayStatistics(::LldbDriver::Value::*)() const >, &::LldbDriver::Value::statistics, bondage::FunctionCaller> { };
+struct LldbDriver_Value_summaries_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::Vector<ValueSummary>(::LldbDriver::Value::*)(size_t, size_t) const >, &::LldbDriver::Value::summaries, bondage::FunctionCaller> { };
 struct LldbDriver_Value_type_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::Type(::LldbDriver::Value::*)() const >, &::LldbDriver::Value::type, bondage::FunctionCaller> { };
 struct LldbDriver_Value_value_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::String(::LldbDriver::Value::*)() const >, &::LldbDriver::Value::value, bondage::FunctionCaller> { };
 
@@ -509,6 +536,9 @@ const bondage::Function LldbDriver_Value_methods[] = {
   bondage::FunctionBuilder::build<
     LldbDriver_Value_address_overload0_t
     >("address"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Value_asArray_overload0_t
+    >("asArray"),
   bondage::FunctionBuilder::build<
     LldbDriver_Value_changed_overload0_t
     >("changed"),
@@ -518,6 +548,9 @@ const bondage::Function LldbDriver_Value_methods[] = {
   bondage::FunctionBuilder::build<
     LldbDriver_Value_childCount_overload0_t
     >("childCount"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Value_children_overload0_t
+    >("children"),
   bondage::FunctionBuilder::build<
     LldbDriver_Value_dereference_overload0_t
     >("dereference"),
@@ -530,6 +563,9 @@ const bondage::Function LldbDriver_Value_methods[] = {
   bondage::FunctionBuilder::build<
     LldbDriver_Value_inScope_overload0_t
     >("inScope"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Value_isContiguousArray_overload0_t
+    >("isContiguousArray"),
   bondage::FunctionBuilder::build<
     LldbDriver_Value_isPointerType_overload0_t
     >("isPointerType"),
@@ -542,6 +578,12 @@ const bondage::Function LldbDriver_Value_methods[] = {
   bondage::FunctionBuilder::build<
     LldbDriver_Value_operatore_overload0_t
     >("operator="),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Value_statistics_overload0_t
+    >("statistics"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Value_summaries_overload0_t
+    >("summaries"),
   bondage::FunctionBuilder::build<
     LldbDriver_Value_type_overload0_t
     >("type"),
@@ -558,7 +600,7 @@ BONDAGE_IMPLEMENT_EXPOSED_CLASS(
   Value,
   void,
   LldbDriver_Value_methods,
-  14);
+  19);
 
 
 
@@ -784,12 +826,20 @@ BONDAGE_IMPLEMENT_EXPOSED_CLASS(
 
 
 // Exposing class ::LldbDriver::Module
+struct LldbDriver_Module_findTypes_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::Vector<Type>(::LldbDriver::Module::*)(const char *) const >, &::LldbDriver::Module::findTypes, bondage::FunctionCaller> { };
 struct LldbDriver_Module_path_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::String(::LldbDriver::Module::*)() const >, &::LldbDriver::Module::path, bondage::FunctionCaller> { };
+struct LldbDriver_Module_uuid_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::String(::LldbDriver::Module::*)() const >, &::LldbDriver::Module::uuid, bondage::FunctionCaller> { };
 
 const bondage::Function LldbDriver_Module_methods[] = {
+  bondage::FunctionBuilder::build<
+    LldbDriver_Module_findTypes_overload0_t
+    >("findTypes"),
   bondage::FunctionBuilder::build<
     LldbDriver_Module_path_overload0_t
-    >("path")
+    >("path"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Module_uuid_overload0_t
+    >("uuid")
 };
 
 
@@ -800,7 +850,7 @@ BONDAGE_IMPLEMENT_EXPOSED_CLASS(
   Module,
   void,
   LldbDriver_Module_methods,
-  1);
+  3);
 
 
 
@@ -837,38 +887,66 @@ struct Breakpoint_Breakpoint_overload : Reflect::FunctionArgumentCountSelector<
     Breakpoint_Breakpoint_overload_0,
     Breakpoint_Breakpoint_overload_1
     > { };
+struct LldbDriver_Breakpoint_condition_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::String(::LldbDriver::Breakpoint::*)() const >, &::LldbDriver::Breakpoint::condition, bondage::FunctionCaller> { };
 struct LldbDriver_Breakpoint_enabled_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< bool(::LldbDriver::Breakpoint::*)() const >, &::LldbDriver::Breakpoint::enabled, bondage::FunctionCaller> { };
 struct LldbDriver_Breakpoint_findLocation_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< std::tuple< bool, LldbDriver::BreakpointLocation >(*)(::LldbDriver::Breakpoint &, const Eks::String &, size_t) >, &LldbDriver_Breakpoint_findLocation_overload0, Reflect::MethodInjectorBuilder<bondage::FunctionCaller>> { };
+struct LldbDriver_Breakpoint_hitCount_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::Breakpoint::*)() const >, &::LldbDriver::Breakpoint::hitCount, bondage::FunctionCaller> { };
 struct LldbDriver_Breakpoint_id_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::Breakpoint::*)() const >, &::LldbDriver::Breakpoint::id, bondage::FunctionCaller> { };
+struct LldbDriver_Breakpoint_ignoreCount_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::Breakpoint::*)() const >, &::LldbDriver::Breakpoint::ignoreCount, bondage::FunctionCaller> { };
 struct LldbDriver_Breakpoint_locationAt_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::BreakpointLocation(::LldbDriver::Breakpoint::*)(size_t) const >, &::LldbDriver::Breakpoint::locationAt, bondage::FunctionCaller> { };
 struct LldbDriver_Breakpoint_locationCount_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::Breakpoint::*)() const >, &::LldbDriver::Breakpoint::locationCount, bondage::FunctionCaller> { };
+struct LldbDriver_Breakpoint_logMessage_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::String(::LldbDriver::Breakpoint::*)() const >, &::LldbDriver::Breakpoint::logMessage, bondage::FunctionCaller> { };
 struct LldbDriver_Breakpoint_operatore_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::Breakpoint &(::LldbDriver::Breakpoint::*)(const LldbDriver::Breakpoint &) >, &::LldbDriver::Breakpoint::operator=, bondage::FunctionCaller> { };
+struct LldbDriver_Breakpoint_setCondition_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::LldbDriver::Breakpoint::*)(const char *) >, &::LldbDriver::Breakpoint::setCondition, bondage::FunctionCaller> { };
 struct LldbDriver_Breakpoint_setEnabled_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::LldbDriver::Breakpoint::*)(bool) >, &::LldbDriver::Breakpoint::setEnabled, bondage::FunctionCaller> { };
+struct LldbDriver_Breakpoint_setIgnoreCount_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::LldbDriver::Breakpoint::*)(size_t) >, &::LldbDriver::Breakpoint::setIgnoreCount, bondage::FunctionCaller> { };
+struct LldbDriver_Breakpoint_setLogMessage_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::LldbDriver::Breakpoint::*)(const char *) >, &::LldbDriver::Breakpoint::setLogMessage, bondage::FunctionCaller> { };
 struct LldbDriver_Breakpoint_target_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< const std::shared_ptr<Target> &(::LldbDriver::Breakpoint::*)() >, &::LldbDriver::Breakpoint::target, bondage::FunctionCaller> { };
 
 const bondage::Function LldbDriver_Breakpoint_methods[] = {
   bondage::FunctionBuilder::buildOverload< Breakpoint_Breakpoint_overload >("Breakpoint"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Breakpoint_condition_overload0_t
+    >("condition"),
   bondage::FunctionBuilder::build<
     LldbDriver_Breakpoint_enabled_overload0_t
     >("enabled"),
   bondage::FunctionBuilder::build<
     LldbDriver_Breakpoint_findLocation_overload0_t
     >("findLocation"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Breakpoint_hitCount_overload0_t
+    >("hitCount"),
   bondage::FunctionBuilder::build<
     LldbDriver_Breakpoint_id_overload0_t
     >("id"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Breakpoint_ignoreCount_overload0_t
+    >("ignoreCount"),
   bondage::FunctionBuilder::build<
     LldbDriver_Breakpoint_locationAt_overload0_t
     >("locationAt"),
   bondage::FunctionBuilder::build<
     LldbDriver_Breakpoint_locationCount_overload0_t
     >("locationCount"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Breakpoint_logMessage_overload0_t
+    >("logMessage"),
   bondage::FunctionBuilder::build<
     LldbDriver_Breakpoint_operatore_overload0_t
     >("operator="),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Breakpoint_setCondition_overload0_t
+    >("setCondition"),
   bondage::FunctionBuilder::build<
     LldbDriver_Breakpoint_setEnabled_overload0_t
     >("setEnabled"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Breakpoint_setIgnoreCount_overload0_t
+    >("setIgnoreCount"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Breakpoint_setLogMessage_overload0_t
+    >("setLogMessage"),
   bondage::FunctionBuilder::build<
     LldbDriver_Breakpoint_target_overload0_t
     >("target")
@@ -882,7 +960,7 @@ BONDAGE_IMPLEMENT_EXPOSED_CLASS(
   Breakpoint,
   void,
   LldbDriver_Breakpoint_methods,
-  9);
+  16);
 
 
 
@@ -933,6 +1011,8 @@ struct LldbDriver_Target_addModule_overload0_t : Reflect::FunctionCall<Reflect::
 struct LldbDriver_Target_attach_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< std::shared_ptr<Process>(::LldbDriver::Target::*)(uint64_t, LldbDriver::Error &) >, &::LldbDriver::Target::attach, bondage::FunctionCaller> { };
 struct LldbDriver_Target_breakpointAt_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::Breakpoint(::LldbDriver::Target::*)(size_t) >, &::LldbDriver::Target::breakpointAt, bondage::FunctionCaller> { };
 struct LldbDriver_Target_breakpointCount_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::Target::*)() >, &::LldbDriver::Target::breakpointCount, bondage::FunctionCaller> { };
+struct LldbDriver_Target_breakpointLines_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::Vector<size_t>(::LldbDriver::Target::*)(const Eks::String &) >, &::LldbDriver::Target::breakpointLines, bondage::FunctionCaller> { };
+struct LldbDriver_Target_breakpointWithId_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::Breakpoint(::LldbDriver::Target::*)(size_t) >, &::LldbDriver::Target::breakpointWithId, bondage::FunctionCaller> { };
 struct LldbDriver_Target_breakpointsChanged_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::BreakpointNotifier *(::LldbDriver::Target::*)() >, &::LldbDriver::Target::breakpointsChanged, bondage::FunctionCaller> { };
 struct LldbDriver_Target_connect_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< std::shared_ptr<Process>(::LldbDriver::Target::*)(const Eks::String &, LldbDriver::Error &) >, &::LldbDriver::Target::connect, bondage::FunctionCaller> { };
 struct LldbDriver_Target_findBreakpoint_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< std::tuple< bool, LldbDriver::Breakpoint, LldbDriver::BreakpointLocation >(*)(::LldbDriver::Target &, const Eks::String &, size_t) >, &LldbDriver_Target_findBreakpoint_overload0, Reflect::MethodInjectorBuilder<bondage::FunctionCaller>> { };
@@ -940,7 +1020,11 @@ struct LldbDriver_Target_launch_overload0_t : Reflect::FunctionCall<Reflect::Fun
 struct LldbDriver_Target_moduleAt_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< std::shared_ptr<Module>(::LldbDriver::Target::*)(size_t) >, &::LldbDriver::Target::moduleAt, bondage::FunctionCaller> { };
 struct LldbDriver_Target_moduleCount_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::Target::*)() >, &::LldbDriver::Target::moduleCount, bondage::FunctionCaller> { };
 struct LldbDriver_Target_path_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::String(::LldbDriver::Target::*)() const >, &::LldbDriver::Target::path, bondage::FunctionCaller> { };
+struct LldbDriver_Target_processEvents_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::LldbDriver::Target::*)() >, &::LldbDriver::Target::processEvents, bondage::FunctionCaller> { };
 struct LldbDriver_Target_removeBreakpoint_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< bool(::LldbDriver::Target::*)(const LldbDriver::Breakpoint &) >, &::LldbDriver::Target::removeBreakpoint, bondage::FunctionCaller> { };
+struct LldbDriver_Target_setStdioMode_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::LldbDriver::Target::*)(LldbDriver::StdioMode) >, &::LldbDriver::Target::setStdioMode, bondage::FunctionCaller> { };
+struct LldbDriver_Target_stdioMode_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::StdioMode(::LldbDriver::Target::*)() const >, &::LldbDriver::Target::stdioMode, bondage::FunctionCaller> { };
+struct LldbDriver_Target_takeBreakpointLog_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::String(::LldbDriver::Target::*)() >, &::LldbDriver::Target::takeBreakpointLog, bondage::FunctionCaller> { };
 
 const bondage::Function LldbDriver_Target_methods[] = {
   bondage::FunctionBuilder::build<
@@ -958,6 +1042,12 @@ const bondage::Function LldbDriver_Target_methods[] = {
   bondage::FunctionBuilder::build<
     LldbDriver_Target_breakpointCount_overload0_t
     >("breakpointCount"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Target_breakpointLines_overload0_t
+    >("breakpointLines"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Target_breakpointWithId_overload0_t
+    >("breakpointWithId"),
   bondage::FunctionBuilder::build<
     LldbDriver_Target_breakpointsChanged_overload0_t
     >("breakpointsChanged"),
@@ -979,9 +1069,21 @@ const bondage::Function LldbDriver_Target_methods[] = {
   bondage::FunctionBuilder::build<
     LldbDriver_Target_path_overload0_t
     >("path"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Target_processEvents_overload0_t
+    >("processEvents"),
   bondage::FunctionBuilder::build<
     LldbDriver_Target_removeBreakpoint_overload0_t
-    >("removeBreakpoint")
+    >("removeBreakpoint"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Target_setStdioMode_overload0_t
+    >("setStdioMode"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Target_stdioMode_overload0_t
+    >("stdioMode"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Target_takeBreakpointLog_overload0_t
+    >("takeBreakpointLog")
 };
 
 
@@ -992,7 +1094,510 @@ BONDAGE_IMPLEMENT_EXPOSED_CLASS(
   Target,
   void,
   LldbDriver_Target_methods,
+  19);
+
+
+
+// Exposing class ::LldbDriver::StopSnapshot
+struct LldbDriver_StopSnapshot_filename_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::String(::LldbDriver::StopSnapshot::*)(size_t, size_t) const >, &::LldbDriver::StopSnapshot::filename, bondage::FunctionCaller> { };
+struct LldbDriver_StopSnapshot_frame_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::Frame(::LldbDriver::StopSnapshot::*)(size_t, size_t) const >, &::LldbDriver::StopSnapshot::frame, bondage::FunctionCaller> { };
+struct LldbDriver_StopSnapshot_frameCount_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::StopSnapshot::*)(size_t) const >, &::LldbDriver::StopSnapshot::frameCount, bondage::FunctionCaller> { };
+struct LldbDriver_StopSnapshot_functionName_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::String(::LldbDriver::StopSnapshot::*)(size_t, size_t) const >, &::LldbDriver::StopSnapshot::functionName, bondage::FunctionCaller> { };
+struct LldbDriver_StopSnapshot_hasLineNumber_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< bool(::LldbDriver::StopSnapshot::*)(size_t, size_t) const >, &::LldbDriver::StopSnapshot::hasLineNumber, bondage::FunctionCaller> { };
+struct LldbDriver_StopSnapshot_lineNumber_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::StopSnapshot::*)(size_t, size_t) const >, &::LldbDriver::StopSnapshot::lineNumber, bondage::FunctionCaller> { };
+struct LldbDriver_StopSnapshot_selectedFrame_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::StopSnapshot::*)(size_t) const >, &::LldbDriver::StopSnapshot::selectedFrame, bondage::FunctionCaller> { };
+struct LldbDriver_StopSnapshot_selectedThread_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::StopSnapshot::*)() const >, &::LldbDriver::StopSnapshot::selectedThread, bondage::FunctionCaller> { };
+struct LldbDriver_StopSnapshot_thread_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< std::shared_ptr<Thread>(::LldbDriver::StopSnapshot::*)(size_t) const >, &::LldbDriver::StopSnapshot::thread, bondage::FunctionCaller> { };
+struct LldbDriver_StopSnapshot_threadCount_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::StopSnapshot::*)() const >, &::LldbDriver::StopSnapshot::threadCount, bondage::FunctionCaller> { };
+struct LldbDriver_StopSnapshot_threadID_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::StopSnapshot::*)(size_t) const >, &::LldbDriver::StopSnapshot::threadID, bondage::FunctionCaller> { };
+struct LldbDriver_StopSnapshot_threadName_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::String(::LldbDriver::StopSnapshot::*)(size_t) const >, &::LldbDriver::StopSnapshot::threadName, bondage::FunctionCaller> { };
+struct LldbDriver_StopSnapshot_totalFrameCount_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::StopSnapshot::*)(size_t) const >, &::LldbDriver::StopSnapshot::totalFrameCount, bondage::FunctionCaller> { };
+
+const bondage::Function LldbDriver_StopSnapshot_methods[] = {
+  bondage::FunctionBuilder::build<
+    LldbDriver_StopSnapshot_filename_overload0_t
+    >("filename"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_StopSnapshot_frame_overload0_t
+    >("frame"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_StopSnapshot_frameCount_overload0_t
+    >("frameCount"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_StopSnapshot_functionName_overload0_t
+    >("functionName"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_StopSnapshot_hasLineNumber_overload0_t
+    >("hasLineNumber"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_StopSnapshot_lineNumber_overload0_t
+    >("lineNumber"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_StopSnapshot_selectedFrame_overload0_t
+    >("selectedFrame"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_StopSnapshot_selectedThread_overload0_t
+    >("selectedThread"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_StopSnapshot_thread_overload0_t
+    >("thread"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_StopSnapshot_threadCount_overload0_t
+    >("threadCount"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_StopSnapshot_threadID_overload0_t
+    >("threadID"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_StopSnapshot_threadName_overload0_t
+    >("threadName"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_StopSnapshot_totalFrameCount_overload0_t
+    >("totalFrameCount")
+};
+
+
+BONDAGE_IMPLEMENT_EXPOSED_CLASS(
+  LldbDriver_StopSnapshot,
+  g_bondage_library_LldbDriver,
+  ::LldbDriver,
+  StopSnapshot,
+  void,
+  LldbDriver_StopSnapshot_methods,
   13);
 
 
 
+// Exposing class ::LldbDriver::ValueSummary
+struct LldbDriver_ValueSummary_child_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::Value(::LldbDriver::ValueSummary::*)() const >, &::LldbDriver::ValueSummary::child, bondage::FunctionCaller> { };
+struct LldbDriver_ValueSummary_mightHaveChildren_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< bool(::LldbDriver::ValueSummary::*)() const >, &::LldbDriver::ValueSummary::mightHaveChildren, bondage::FunctionCaller> { };
+struct LldbDriver_ValueSummary_name_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::String(::LldbDriver::ValueSummary::*)() const >, &::LldbDriver::ValueSummary::name, bondage::FunctionCaller> { };
+struct LldbDriver_ValueSummary_typeName_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::String(::LldbDriver::ValueSummary::*)() const >, &::LldbDriver::ValueSummary::typeName, bondage::FunctionCaller> { };
+struct LldbDriver_ValueSummary_value_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::String(::LldbDriver::ValueSummary::*)() const >, &::LldbDriver::ValueSummary::value, bondage::FunctionCaller> { };
+
+const bondage::Function LldbDriver_ValueSummary_methods[] = {
+  bondage::FunctionBuilder::build<
+    LldbDriver_ValueSummary_child_overload0_t
+    >("child"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_ValueSummary_mightHaveChildren_overload0_t
+    >("mightHaveChildren"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_ValueSummary_name_overload0_t
+    >("name"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_ValueSummary_typeName_overload0_t
+    >("typeName"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_ValueSummary_value_overload0_t
+    >("value")
+};
+
+
+BONDAGE_IMPLEMENT_EXPOSED_CLASS(
+  LldbDriver_ValueSummary,
+  g_bondage_library_LldbDriver,
+  ::LldbDriver,
+  ValueSummary,
+  void,
+  LldbDriver_ValueSummary_methods,
+  5);
+
+
+
+// Exposing class ::LldbDriver::SymbolIndex
+struct LldbDriver_SymbolIndex_find_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::Vector<SymbolMatch>(::LldbDriver::SymbolIndex::*)(const char *, size_t) const >, &::LldbDriver::SymbolIndex::find, bondage::FunctionCaller> { };
+struct LldbDriver_SymbolIndex_isReady_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< bool(::LldbDriver::SymbolIndex::*)() const >, &::LldbDriver::SymbolIndex::isReady, bondage::FunctionCaller> { };
+struct LldbDriver_SymbolIndex_refresh_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::LldbDriver::SymbolIndex::*)() >, &::LldbDriver::SymbolIndex::refresh, bondage::FunctionCaller> { };
+struct LldbDriver_SymbolIndex_symbolCount_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::SymbolIndex::*)() const >, &::LldbDriver::SymbolIndex::symbolCount, bondage::FunctionCaller> { };
+
+const bondage::Function LldbDriver_SymbolIndex_methods[] = {
+  bondage::FunctionBuilder::build<
+    LldbDriver_SymbolIndex_find_overload0_t
+    >("find"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_SymbolIndex_isReady_overload0_t
+    >("isReady"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_SymbolIndex_refresh_overload0_t
+    >("refresh"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_SymbolIndex_symbolCount_overload0_t
+    >("symbolCount")
+};
+
+
+BONDAGE_IMPLEMENT_EXPOSED_CLASS(
+  LldbDriver_SymbolIndex,
+  g_bondage_library_LldbDriver,
+  ::LldbDriver,
+  SymbolIndex,
+  void,
+  LldbDriver_SymbolIndex_methods,
+  4);
+
+
+
+// Exposing class ::LldbDriver::SymbolMatch
+struct LldbDriver_SymbolMatch_filename_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::String(::LldbDriver::SymbolMatch::*)() const >, &::LldbDriver::SymbolMatch::filename, bondage::FunctionCaller> { };
+struct LldbDriver_SymbolMatch_hasLineNumber_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< bool(::LldbDriver::SymbolMatch::*)() const >, &::LldbDriver::SymbolMatch::hasLineNumber, bondage::FunctionCaller> { };
+struct LldbDriver_SymbolMatch_isType_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< bool(::LldbDriver::SymbolMatch::*)() const >, &::LldbDriver::SymbolMatch::isType, bondage::FunctionCaller> { };
+struct LldbDriver_SymbolMatch_lineNumber_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::SymbolMatch::*)() const >, &::LldbDriver::SymbolMatch::lineNumber, bondage::FunctionCaller> { };
+struct LldbDriver_SymbolMatch_modulePath_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::String(::LldbDriver::SymbolMatch::*)() const >, &::LldbDriver::SymbolMatch::modulePath, bondage::FunctionCaller> { };
+struct LldbDriver_SymbolMatch_name_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::String(::LldbDriver::SymbolMatch::*)() const >, &::LldbDriver::SymbolMatch::name, bondage::FunctionCaller> { };
+struct LldbDriver_SymbolMatch_score_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< int(::LldbDriver::SymbolMatch::*)() const >, &::LldbDriver::SymbolMatch::score, bondage::FunctionCaller> { };
+
+const bondage::Function LldbDriver_SymbolMatch_methods[] = {
+  bondage::FunctionBuilder::build<
+    LldbDriver_SymbolMatch_filename_overload0_t
+    >("filename"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_SymbolMatch_hasLineNumber_overload0_t
+    >("hasLineNumber"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_SymbolMatch_isType_overload0_t
+    >("isType"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_SymbolMatch_lineNumber_overload0_t
+    >("lineNumber"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_SymbolMatch_modulePath_overload0_t
+    >("modulePath"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_SymbolMatch_name_overload0_t
+    >("name"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_SymbolMatch_score_overload0_t
+    >("score")
+};
+
+
+BONDAGE_IMPLEMENT_EXPOSED_CLASS(
+  LldbDriver_SymbolMatch,
+  g_bondage_library_LldbDriver,
+  ::LldbDriver,
+  SymbolMatch,
+  void,
+  LldbDriver_SymbolMatch_methods,
+  7);
+
+
+
+// Exposing class ::LldbDriver::BreakpointChange
+struct LldbDriver_BreakpointChange_breakpoint_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::BreakpointChange::*)() const >, &::LldbDriver::BreakpointChange::breakpoint, bondage::FunctionCaller> { };
+struct LldbDriver_BreakpointChange_files_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::Vector<Eks::String>(::LldbDriver::BreakpointChange::*)() const >, &::LldbDriver::BreakpointChange::files, bondage::FunctionCaller> { };
+struct LldbDriver_BreakpointChange_locations_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::Vector<int>(::LldbDriver::BreakpointChange::*)() const >, &::LldbDriver::BreakpointChange::locations, bondage::FunctionCaller> { };
+struct LldbDriver_BreakpointChange_type_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::BreakpointChange::Type(::LldbDriver::BreakpointChange::*)() const >, &::LldbDriver::BreakpointChange::type, bondage::FunctionCaller> { };
+
+const bondage::Function LldbDriver_BreakpointChange_methods[] = {
+  bondage::FunctionBuilder::build<
+    LldbDriver_BreakpointChange_breakpoint_overload0_t
+    >("breakpoint"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_BreakpointChange_files_overload0_t
+    >("files"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_BreakpointChange_locations_overload0_t
+    >("locations"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_BreakpointChange_type_overload0_t
+    >("type")
+};
+
+
+BONDAGE_IMPLEMENT_EXPOSED_CLASS(
+  LldbDriver_BreakpointChange,
+  g_bondage_library_LldbDriver,
+  ::LldbDriver,
+  BreakpointChange,
+  void,
+  LldbDriver_BreakpointChange_methods,
+  4);
+
+
+
+// Exposing class ::LldbDriver::FrameValues
+struct LldbDriver_FrameValues_changed_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::Vector<size_t>(::LldbDriver::FrameValues::*)() const >, &::LldbDriver::FrameValues::changed, bondage::FunctionCaller> { };
+struct LldbDriver_FrameValues_clear_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::LldbDriver::FrameValues::*)() >, &::LldbDriver::FrameValues::clear, bondage::FunctionCaller> { };
+struct LldbDriver_FrameValues_count_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::FrameValues::*)() const >, &::LldbDriver::FrameValues::count, bondage::FunctionCaller> { };
+struct LldbDriver_FrameValues_create_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< FrameValues::Pointer(*)() >, &::LldbDriver::FrameValues::create, bondage::FunctionCaller> { };
+struct LldbDriver_FrameValues_isArgument_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< bool(::LldbDriver::FrameValues::*)(size_t) const >, &::LldbDriver::FrameValues::isArgument, bondage::FunctionCaller> { };
+struct LldbDriver_FrameValues_update_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< bool(::LldbDriver::FrameValues::*)(const Frame &) >, &::LldbDriver::FrameValues::update, bondage::FunctionCaller> { };
+struct LldbDriver_FrameValues_valueAt_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Value(::LldbDriver::FrameValues::*)(size_t) const >, &::LldbDriver::FrameValues::valueAt, bondage::FunctionCaller> { };
+
+const bondage::Function LldbDriver_FrameValues_methods[] = {
+  bondage::FunctionBuilder::build<
+    LldbDriver_FrameValues_changed_overload0_t
+    >("changed"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_FrameValues_clear_overload0_t
+    >("clear"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_FrameValues_count_overload0_t
+    >("count"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_FrameValues_create_overload0_t
+    >("create"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_FrameValues_isArgument_overload0_t
+    >("isArgument"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_FrameValues_update_overload0_t
+    >("update"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_FrameValues_valueAt_overload0_t
+    >("valueAt")
+};
+
+
+BONDAGE_IMPLEMENT_EXPOSED_CLASS(
+  LldbDriver_FrameValues,
+  g_bondage_library_LldbDriver,
+  ::LldbDriver,
+  FrameValues,
+  void,
+  LldbDriver_FrameValues_methods,
+  7);
+
+
+
+// Exposing class ::LldbDriver::ArrayStatistics
+struct LldbDriver_ArrayStatistics_count_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::ArrayStatistics::*)() const >, &::LldbDriver::ArrayStatistics::count, bondage::FunctionCaller> { };
+struct LldbDriver_ArrayStatistics_isValid_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< bool(::LldbDriver::ArrayStatistics::*)() const >, &::LldbDriver::ArrayStatistics::isValid, bondage::FunctionCaller> { };
+struct LldbDriver_ArrayStatistics_maximum_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< double(::LldbDriver::ArrayStatistics::*)() const >, &::LldbDriver::ArrayStatistics::maximum, bondage::FunctionCaller> { };
+struct LldbDriver_ArrayStatistics_mean_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< double(::LldbDriver::ArrayStatistics::*)() const >, &::LldbDriver::ArrayStatistics::mean, bondage::FunctionCaller> { };
+struct LldbDriver_ArrayStatistics_minimum_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< double(::LldbDriver::ArrayStatistics::*)() const >, &::LldbDriver::ArrayStatistics::minimum, bondage::FunctionCaller> { };
+struct LldbDriver_ArrayStatistics_sum_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< double(::LldbDriver::ArrayStatistics::*)() const >, &::LldbDriver::ArrayStatistics::sum, bondage::FunctionCaller> { };
+
+const bondage::Function LldbDriver_ArrayStatistics_methods[] = {
+  bondage::FunctionBuilder::build<
+    LldbDriver_ArrayStatistics_count_overload0_t
+    >("count"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_ArrayStatistics_isValid_overload0_t
+    >("isValid"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_ArrayStatistics_maximum_overload0_t
+    >("maximum"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_ArrayStatistics_mean_overload0_t
+    >("mean"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_ArrayStatistics_minimum_overload0_t
+    >("minimum"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_ArrayStatistics_sum_overload0_t
+    >("sum")
+};
+
+
+BONDAGE_IMPLEMENT_EXPOSED_CLASS(
+  LldbDriver_ArrayStatistics,
+  g_bondage_library_LldbDriver,
+  ::LldbDriver,
+  ArrayStatistics,
+  void,
+  LldbDriver_ArrayStatistics_methods,
+  6);
+
+
+
+// Exposing class ::LldbDriver::Evaluator
+struct LldbDriver_Evaluator_cacheSize_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::Evaluator::*)() const >, &::LldbDriver::Evaluator::cacheSize, bondage::FunctionCaller> { };
+struct LldbDriver_Evaluator_clear_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::LldbDriver::Evaluator::*)() >, &::LldbDriver::Evaluator::clear, bondage::FunctionCaller> { };
+struct LldbDriver_Evaluator_create_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Evaluator::Pointer(*)() >, &::LldbDriver::Evaluator::create, bondage::FunctionCaller> { };
+struct LldbDriver_Evaluator_evaluate_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::Evaluation(::LldbDriver::Evaluator::*)(const LldbDriver::Frame &, const char *) >, &::LldbDriver::Evaluator::evaluate, bondage::FunctionCaller> { };
+struct LldbDriver_Evaluator_policy_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::EvaluationPolicy(::LldbDriver::Evaluator::*)() const >, &::LldbDriver::Evaluator::policy, bondage::FunctionCaller> { };
+struct LldbDriver_Evaluator_setPolicy_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::LldbDriver::Evaluator::*)(LldbDriver::EvaluationPolicy) >, &::LldbDriver::Evaluator::setPolicy, bondage::FunctionCaller> { };
+struct LldbDriver_Evaluator_setTimeout_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::LldbDriver::Evaluator::*)(size_t) >, &::LldbDriver::Evaluator::setTimeout, bondage::FunctionCaller> { };
+struct LldbDriver_Evaluator_timeout_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::Evaluator::*)() const >, &::LldbDriver::Evaluator::timeout, bondage::FunctionCaller> { };
+
+const bondage::Function LldbDriver_Evaluator_methods[] = {
+  bondage::FunctionBuilder::build<
+    LldbDriver_Evaluator_cacheSize_overload0_t
+    >("cacheSize"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Evaluator_clear_overload0_t
+    >("clear"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Evaluator_create_overload0_t
+    >("create"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Evaluator_evaluate_overload0_t
+    >("evaluate"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Evaluator_policy_overload0_t
+    >("policy"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Evaluator_setPolicy_overload0_t
+    >("setPolicy"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Evaluator_setTimeout_overload0_t
+    >("setTimeout"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Evaluator_timeout_overload0_t
+    >("timeout")
+};
+
+
+BONDAGE_IMPLEMENT_EXPOSED_CLASS(
+  LldbDriver_Evaluator,
+  g_bondage_library_LldbDriver,
+  ::LldbDriver,
+  Evaluator,
+  void,
+  LldbDriver_Evaluator_methods,
+  8);
+
+
+
+// Exposing class ::LldbDriver::Evaluation
+struct LldbDriver_Evaluation_error_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::String(::LldbDriver::Evaluation::*)() const >, &::LldbDriver::Evaluation::error, bondage::FunctionCaller> { };
+struct LldbDriver_Evaluation_method_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::EvaluationMethod(::LldbDriver::Evaluation::*)() const >, &::LldbDriver::Evaluation::method, bondage::FunctionCaller> { };
+struct LldbDriver_Evaluation_value_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::Value(::LldbDriver::Evaluation::*)() const >, &::LldbDriver::Evaluation::value, bondage::FunctionCaller> { };
+
+const bondage::Function LldbDriver_Evaluation_methods[] = {
+  bondage::FunctionBuilder::build<
+    LldbDriver_Evaluation_error_overload0_t
+    >("error"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Evaluation_method_overload0_t
+    >("method"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_Evaluation_value_overload0_t
+    >("value")
+};
+
+
+BONDAGE_IMPLEMENT_EXPOSED_CLASS(
+  LldbDriver_Evaluation,
+  g_bondage_library_LldbDriver,
+  ::LldbDriver,
+  Evaluation,
+  void,
+  LldbDriver_Evaluation_methods,
+  3);
+
+
+
+// Exposing class ::LldbDriver::WatchSet
+struct LldbDriver_WatchSet_add_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::WatchSet::*)(const char *) >, &::LldbDriver::WatchSet::add, bondage::FunctionCaller> { };
+struct LldbDriver_WatchSet_create_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< WatchSet::Pointer(*)() >, &::LldbDriver::WatchSet::create, bondage::FunctionCaller> { };
+struct LldbDriver_WatchSet_evaluate_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::LldbDriver::WatchSet::*)(const LldbDriver::Frame &) >, &::LldbDriver::WatchSet::evaluate, bondage::FunctionCaller> { };
+struct LldbDriver_WatchSet_evaluator_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Evaluator::Pointer(::LldbDriver::WatchSet::*)() const >, &::LldbDriver::WatchSet::evaluator, bondage::FunctionCaller> { };
+struct LldbDriver_WatchSet_expression_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::String(::LldbDriver::WatchSet::*)(size_t) const >, &::LldbDriver::WatchSet::expression, bondage::FunctionCaller> { };
+struct LldbDriver_WatchSet_ids_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::Vector<size_t>(::LldbDriver::WatchSet::*)() const >, &::LldbDriver::WatchSet::ids, bondage::FunctionCaller> { };
+struct LldbDriver_WatchSet_isEvaluating_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< bool(::LldbDriver::WatchSet::*)() const >, &::LldbDriver::WatchSet::isEvaluating, bondage::FunctionCaller> { };
+struct LldbDriver_WatchSet_markStale_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::LldbDriver::WatchSet::*)() >, &::LldbDriver::WatchSet::markStale, bondage::FunctionCaller> { };
+struct LldbDriver_WatchSet_remove_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::LldbDriver::WatchSet::*)(size_t) >, &::LldbDriver::WatchSet::remove, bondage::FunctionCaller> { };
+struct LldbDriver_WatchSet_result_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::WatchResult(::LldbDriver::WatchSet::*)(size_t) const >, &::LldbDriver::WatchSet::result, bondage::FunctionCaller> { };
+struct LldbDriver_WatchSet_setExpression_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::LldbDriver::WatchSet::*)(size_t, const char *) >, &::LldbDriver::WatchSet::setExpression, bondage::FunctionCaller> { };
+
+const bondage::Function LldbDriver_WatchSet_methods[] = {
+  bondage::FunctionBuilder::build<
+    LldbDriver_WatchSet_add_overload0_t
+    >("add"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_WatchSet_create_overload0_t
+    >("create"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_WatchSet_evaluate_overload0_t
+    >("evaluate"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_WatchSet_evaluator_overload0_t
+    >("evaluator"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_WatchSet_expression_overload0_t
+    >("expression"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_WatchSet_ids_overload0_t
+    >("ids"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_WatchSet_isEvaluating_overload0_t
+    >("isEvaluating"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_WatchSet_markStale_overload0_t
+    >("markStale"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_WatchSet_remove_overload0_t
+    >("remove"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_WatchSet_result_overload0_t
+    >("result"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_WatchSet_setExpression_overload0_t
+    >("setExpression")
+};
+
+
+BONDAGE_IMPLEMENT_EXPOSED_CLASS(
+  LldbDriver_WatchSet,
+  g_bondage_library_LldbDriver,
+  ::LldbDriver,
+  WatchSet,
+  void,
+  LldbDriver_WatchSet_methods,
+  11);
+
+
+
+// Exposing class ::LldbDriver::WatchResult
+struct LldbDriver_WatchResult_cost_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::WatchResult::*)() const >, &::LldbDriver::WatchResult::cost, bondage::FunctionCaller> { };
+struct LldbDriver_WatchResult_error_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::String(::LldbDriver::WatchResult::*)() const >, &::LldbDriver::WatchResult::error, bondage::FunctionCaller> { };
+struct LldbDriver_WatchResult_evaluationCount_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::WatchResult::*)() const >, &::LldbDriver::WatchResult::evaluationCount, bondage::FunctionCaller> { };
+struct LldbDriver_WatchResult_expression_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::String(::LldbDriver::WatchResult::*)() const >, &::LldbDriver::WatchResult::expression, bondage::FunctionCaller> { };
+struct LldbDriver_WatchResult_isPending_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< bool(::LldbDriver::WatchResult::*)() const >, &::LldbDriver::WatchResult::isPending, bondage::FunctionCaller> { };
+struct LldbDriver_WatchResult_isStale_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< bool(::LldbDriver::WatchResult::*)() const >, &::LldbDriver::WatchResult::isStale, bondage::FunctionCaller> { };
+struct LldbDriver_WatchResult_method_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::EvaluationMethod(::LldbDriver::WatchResult::*)() const >, &::LldbDriver::WatchResult::method, bondage::FunctionCaller> { };
+struct LldbDriver_WatchResult_totalCost_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::LldbDriver::WatchResult::*)() const >, &::LldbDriver::WatchResult::totalCost, bondage::FunctionCaller> { };
+struct LldbDriver_WatchResult_typeName_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::String(::LldbDriver::WatchResult::*)() const >, &::LldbDriver::WatchResult::typeName, bondage::FunctionCaller> { };
+struct LldbDriver_WatchResult_value_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< LldbDriver::Value(::LldbDriver::WatchResult::*)() const >, &::LldbDriver::WatchResult::value, bondage::FunctionCaller> { };
+struct LldbDriver_WatchResult_valueString_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Eks::String(::LldbDriver::WatchResult::*)() const >, &::LldbDriver::WatchResult::valueString, bondage::FunctionCaller> { };
+
+const bondage::Function LldbDriver_WatchResult_methods[] = {
+  bondage::FunctionBuilder::build<
+    LldbDriver_WatchResult_cost_overload0_t
+    >("cost"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_WatchResult_error_overload0_t
+    >("error"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_WatchResult_evaluationCount_overload0_t
+    >("evaluationCount"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_WatchResult_expression_overload0_t
+    >("expression"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_WatchResult_isPending_overload0_t
+    >("isPending"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_WatchResult_isStale_overload0_t
+    >("isStale"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_WatchResult_method_overload0_t
+    >("method"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_WatchResult_totalCost_overload0_t
+    >("totalCost"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_WatchResult_typeName_overload0_t
+    >("typeName"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_WatchResult_value_overload0_t
+    >("value"),
+  bondage::FunctionBuilder::build<
+    LldbDriver_WatchResult_valueString_overload0_t
+    >("valueString")
+};
+
+
+BONDAGE_IMPLEMENT_EXPOSED_CLASS(
+  LldbDriver_WatchResult,
+  g_bondage_library_LldbDriver,
+  ::LldbDriver,
+  WatchResult,
+  void,
+  LldbDriver_WatchResult_methods,
+  11);
+
+
+
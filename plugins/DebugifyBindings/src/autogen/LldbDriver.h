@@ -14,6 +14,11 @@
 #include "Type.h"
 #include "Module.h"
 #include "Breakpoint.h"
+#include "StopSnapshot.h"
+#include "SymbolIndex.h"
+#include "FrameValues.h"
+#include "Evaluator.h"
+#include "WatchSet.h"
 #include "../../BindingGenerator/EksBindings/EksBindings.h"
 #include "../../DebugifyBindings/ManualBindings/ManualBindings.h"
 #include "bondage/RuntimeHelpers.h"
@@ -43,4 +48,19 @@ BONDAGE_EXPOSED_CLASS_COPYABLE(EXPORT_DEBUGIFY, ::LldbDriver::Breakpoint)
 BONDAGE_EXPOSED_CLASS_COPYABLE(EXPORT_DEBUGIFY, ::LldbDriver::BreakpointLocation)
 BONDAGE_EXPOSED_CLASS_SHARED_POINTER(EXPORT_DEBUGIFY, ::LldbDriver::Target)
 BONDAGE_EXPOSED_ENUM(EXPORT_DEBUGIFY, ::LldbDriver::ProcessState)
+BONDAGE_EXPOSED_CLASS_SHARED_POINTER(EXPORT_DEBUGIFY, ::LldbDriver::StopSnapshot)
+BONDAGE_EXPOSED_CLASS_COPYABLE(EXPORT_DEBUGIFY, ::LldbDriver::ValueSummary)
+BONDAGE_EXPOSED_CLASS_SHARED_POINTER(EXPORT_DEBUGIFY, ::LldbDriver::SymbolIndex)
+BONDAGE_EXPOSED_CLASS_COPYABLE(EXPORT_DEBUGIFY, ::LldbDriver::SymbolMatch)
+BONDAGE_EXPOSED_CLASS_COPYABLE(EXPORT_DEBUGIFY, ::LldbDriver::BreakpointChange)
+BONDAGE_EXPOSED_ENUM(EXPORT_DEBUGIFY, ::LldbDriver::BreakpointChange::Type)
+BONDAGE_EXPOSED_ENUM(EXPORT_DEBUGIFY, ::LldbDriver::StdioMode)
+BONDAGE_EXPOSED_CLASS_SHARED_POINTER(EXPORT_DEBUGIFY, ::LldbDriver::FrameValues)
+BONDAGE_EXPOSED_CLASS_COPYABLE(EXPORT_DEBUGIFY, ::LldbDriver::ArrayStatistics)
+BONDAGE_EXPOSED_CLASS_SHARED_POINTER(EXPORT_DEBUGIFY, ::LldbDriver::Evaluator)
+BONDAGE_EXPOSED_ENUM(EXPORT_DEBUGIFY, ::LldbDriver::EvaluationPolicy)
+BONDAGE_EXPOSED_ENUM(EXPORT_DEBUGIFY, ::LldbDriver::EvaluationMethod)
+BONDAGE_EXPOSED_CLASS_COPYABLE(EXPORT_DEBUGIFY, ::LldbDriver::Evaluation)
+BONDAGE_EXPOSED_CLASS_SHARED_POINTER(EXPORT_DEBUGIFY, ::LldbDriver::WatchSet)
+BONDAGE_EXPOSED_CLASS_COPYABLE(EXPORT_DEBUGIFY, ::LldbDriver::WatchResult)
 
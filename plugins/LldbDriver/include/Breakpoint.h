@@ -14,16 +14,20 @@ public:
   /// \noexpose
   BreakpointLocation();
   /// \noexpose
-  BreakpointLocation(int id, const char *file, size_t line, bool resolved);
+  BreakpointLocation(int id, const std::shared_ptr<const Eks::String> &file, size_t line, bool resolved);
 
   int id() const { return _id; }
-  Eks::String file() const { return _file; }
+  Eks::String file() const { return _file ? *_file : Eks::String(); }
   size_t line() const { return _line; }
   bool resolved() const { return _resolved; }
 
+  /// The file path, interned by the target so locations in the same file share a pointer.
+  /// \noexpose
+  const std::shared_ptr<const Eks::String> &internedFile() const { return _file; }
+
 private:
   int _id;
-  Eks::String _file;
+  std::shared_ptr<const Eks::String> _file;
   size_t _line;
   bool _resolved;
   };
@@ -47,6 +51,21 @@ public:
   bool enabled() const;
   void setEnabled(bool e);
 
+  /// Only stop when [condition] is true, lldb evaluates it in the stopped thread. Empty to always stop.
+  Eks::String condition() const;
+  void setCondition(const char *condition);
+
+  /// Number of hits to pass over before stopping.
+  size_t ignoreCount() const;
+  void setIgnoreCount(size_t count);
+
+  size_t hitCount() const;
+
+  /// Log [message] and continue instead of stopping. Variable paths in braces are replaced by their
+  /// values in the stopped frame, eg "x = {x}, y = {p->y}". Empty to stop as normal.
+  Eks::String logMessage() const;
+  void setLogMessage(const char *message);
+
   size_t locationCount() const;
   BreakpointLocation locationAt(size_t i) const;
 
@@ -0,0 +1,87 @@
+#pragma once
+#include "Global.h"
+#include "Value.h"
+#include "Containers/XStringSimple.h"
+
+namespace LldbDriver
+{
+
+class Frame;
+class Evaluation;
+
+/// How far an Evaluator may go to answer an expression.
+/// \expose
+enum class EvaluationPolicy
+  {
+  VariablesOnly = 0, ///< Only variable paths (a.b->c[2]), which read memory and never run the target.
+  RunTarget          ///< Anything the expression parser accepts, running the target for up to the timeout if it must.
+  };
+
+/// How the last expression given to an Evaluator was answered.
+/// \expose
+enum class EvaluationMethod
+  {
+  None = 0,
+  Cached,       ///< Already evaluated in this frame at this stop.
+  VariablePath, ///< Found as a variable path, without the expression parser.
+  Expression,   ///< Compiled and run by the expression parser.
+  Failed        ///< Couldn't be evaluated, see Evaluation::error.
+  };
+
+/// Evaluates expressions in frames, remembering per function how each expression was answered.
+/// Simple member chains are found as variable paths, whose values are kept and re-read at the
+/// next stop in the same frame and block, and expressions that fail to compile aren't compiled
+/// again at the same pc. Repeated evaluations at the same stop are answered from the cache.
+/// \expose sharedpointer
+class Evaluator
+  {
+  SHARED_CLASS(Evaluator);
+  PIMPL_CLASS(Evaluator, sizeof(void*) * 32);
+
+public:
+  /// \noexpose
+  Evaluator();
+  ~Evaluator();
+
+  static Pointer create();
+
+  EvaluationPolicy policy() const;
+  void setPolicy(EvaluationPolicy policy);
+
+  /// The longest an expression may run the target for, in microseconds.
+  size_t timeout() const;
+  void setTimeout(size_t microseconds);
+
+  /// Evaluate [expression] in [frame]. Safe to call from any thread.
+  Evaluation evaluate(const Frame &frame, const char *expression);
+
+  size_t cacheSize() const;
+  void clear();
+
+  friend class Frame;
+  };
+
+/// The result of Evaluator::evaluate, with how it was found, so it can't be confused
+/// with another thread's evaluation.
+/// \expose
+class Evaluation
+  {
+public:
+  /// \noexpose
+  Evaluation();
+
+  /// The value found, invalid if the evaluation failed.
+  Value value() const { return _value; }
+  EvaluationMethod method() const { return _method; }
+  /// Why the evaluation failed, empty unless method is Failed.
+  Eks::String error() const { return _error; }
+
+private:
+  Value _value;
+  EvaluationMethod _method;
+  Eks::String _error;
+
+  friend class Evaluator;
+  };
+
+}
@@ -39,6 +39,9 @@ public:
   Value evaluate(const char *e) const;
 
   friend class Thread;
+  friend class FrameValues;
+  friend class Evaluator;
+  friend class StopSnapshot;
   };
 
 }
@@ -0,0 +1,40 @@
+#pragma once
+#include "Global.h"
+#include "Containers/XVector.h"
+
+namespace LldbDriver
+{
+
+class Frame;
+class Value;
+
+/// The arguments and locals of a frame, kept between stops while the frame is the same one
+/// (same canonical frame address and function), so the values are reused rather than rebuilt.
+/// Each update re-reads only the memory backing the variables, and records which of them changed.
+/// \expose sharedpointer
+class FrameValues
+  {
+  SHARED_CLASS(FrameValues);
+  PIMPL_CLASS(FrameValues, sizeof(void*) * 16);
+
+public:
+  /// \noexpose
+  FrameValues();
+  ~FrameValues();
+
+  static Pointer create();
+
+  /// Track [frame]. Returns true if it is the frame tracked before, and the values were
+  /// kept and compared, or false if they were rebuilt and everything should be redrawn.
+  bool update(const Frame &frame);
+  void clear();
+
+  size_t count() const;
+  Value valueAt(size_t i) const;
+  bool isArgument(size_t i) const;
+
+  /// Indices of the values whose bytes differ from the previous update, in increasing order.
+  Eks::Vector<size_t> changed() const;
+  };
+
+}
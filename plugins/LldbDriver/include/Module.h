@@ -1,6 +1,7 @@
 #pragma once
 #include "Global.h"
 #include "Containers/XStringSimple.h"
+#include "Containers/XVector.h"
 #include <set>
 #include <vector>
 
@@ -8,6 +9,7 @@ namespace LldbDriver
 {
 
 class CompileUnit;
+class Type;
 
 /// \expose sharedpointer
 class Module
@@ -21,12 +23,18 @@ public:
   ~Module();
 
   Eks::String path() const;
+  /// The build UUID of the module, empty if it has none.
+  Eks::String uuid() const;
 
   std::set<Eks::String> files() const;
 
   const std::vector<std::shared_ptr<LldbDriver::CompileUnit>> &compileUnits() const;
 
+  /// Look up the types called [name] without walking every compile unit.
+  Eks::Vector<Type> findTypes(const char *name) const;
+
   friend class Target;
+  friend class SymbolIndex;
   };
 
 }
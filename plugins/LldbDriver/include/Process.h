@@ -2,6 +2,9 @@
 #include "Global.h"
 #include "Containers/XStringSimple.h"
 #include "Utilities/XNotifier.h"
+#include "Containers/XVector.h"
+#include <functional>
+#include <vector>
 
 namespace LldbDriver
 {
@@ -9,6 +12,7 @@ namespace LldbDriver
 class Error;
 class Target;
 class Thread;
+class StopSnapshot;
 
 /// \expose
 enum class ProcessState
@@ -29,6 +33,15 @@ enum class ProcessState
                 ///< or threads get the chance to run.
   };
 
+/// Where the standard streams of a launched process go.
+/// \expose
+enum class StdioMode
+  {
+  Debugger = 0, ///< Proxied by lldb, which reports output through its event broadcasts.
+  Pipes,        ///< Named pipes read by Debugify, keeping stdout and stderr apart.
+  Pty           ///< A pseudo terminal read by Debugify, for programs that expect a terminal.
+  };
+
 /// \expose unmanaged
 X_DECLARE_NOTIFIER(ProcessStateChangeNotifier, std::function<void (ProcessState)>);
 
@@ -39,7 +52,7 @@ X_DECLARE_NOTIFIER(NoArgNotifier, std::function<void ()>);
 class Process
   {
   SHARED_CLASS(Process);
-  PIMPL_CLASS(Process, sizeof(void*) * 36);
+  PIMPL_CLASS(Process, sizeof(void*) * 64);
 
 public:
   /// \noexpose
@@ -56,6 +69,8 @@ public:
 
   NoArgNotifier *outputAvailable();
   NoArgNotifier *errorAvailable();
+  /// Fired when breakpoint log actions have written lines, collect them with Target::takeBreakpointLog.
+  NoArgNotifier *breakpointLogAvailable();
 
   enum class OutputType
     {
@@ -64,11 +79,35 @@ public:
     };
 
   size_t getOutput(OutputType type, char *data, size_t inputSize);
-  /// Get the output from the process
+  /// Read everything waiting on [type] onto the end of [buffer], directly into its storage.
+  /// Reusing the buffer between calls avoids allocating, returns the number of bytes read.
+  /// \noexpose
+  size_t drainOutput(OutputType type, std::vector<char> &buffer);
+  /// Get the output from the process, each stream drained into one string.
   /// \param[out] out
   /// \param[out] err
   void getOutputs(Eks::String &out, Eks::String &err);
 
+  /// Write [input] to the process' stdin.
+  void writeInput(const Eks::String &input);
+
+  /// Read up to [size] bytes of memory at [address], stopping at the first unreadable page.
+  /// Memory is read a run of pages at a time and cached until the process resumes, so reading
+  /// nearby, or the same memory again, doesn't go back to the process.
+  Eks::Vector<uint8_t> readMemory(uint64_t address, size_t size);
+  /// Read into [data], returning the number of bytes read.
+  /// \noexpose
+  size_t readMemory(uint64_t address, uint8_t *data, size_t size);
+
+  typedef std::function<void (uint64_t address, const uint8_t *data, size_t size)> MemoryChunkCallback;
+  /// Read [size] bytes at [address] on a background thread, calling [chunk] from that thread with
+  /// each [chunkSize] block read, until the end or an unreadable page. [chunk] may be empty to only
+  /// fill the cache ahead of reading. Queued reads are dropped when the process resumes.
+  /// \noexpose
+  void readMemoryAsync(uint64_t address, size_t size, size_t chunkSize, const MemoryChunkCallback &chunk);
+  /// Drop any queued asynchronous reads, and wait for the one in progress to stop.
+  void cancelMemoryReads();
+
   Error kill();
   Error pauseExecution();
   Error continueExecution();
@@ -82,13 +121,26 @@ public:
   void selectThread(const std::shared_ptr<Thread> &);
   std::shared_ptr<Thread> selectedThread();
 
+  /// Find the threads and frames of the stopped process. The snapshot is captured on first request
+  /// after a stop and shared until the process resumes or the selection changes.
+  std::shared_ptr<StopSnapshot> stopSnapshot();
+
+  /// Deliver any events queued by the listener thread, fires the notifiers on the calling thread.
   void processEvents();
 
+  /// Set a function called from the listener thread when new events are queued.
+  /// The function should arrange for processEvents to be called on the owning thread.
+  /// It is also called when the target's breakpoints change, which Target::processEvents delivers.
+  /// \noexpose
+  void setEventsAvailableCallback(const std::function<void ()> &fn);
+
   ProcessStateChangeNotifier *stateChanged();
   NoArgNotifier *ended();
 
 
   friend class Target;
+  friend class Thread;
+  friend class StopSnapshot;
   };
 
 }
@@ -0,0 +1,51 @@
+#pragma once
+#include "Global.h"
+#include "Containers/XStringSimple.h"
+
+namespace LldbDriver
+{
+
+class Process;
+class Thread;
+class Frame;
+
+/// An immutable capture of the threads and top frames of a stopped process.
+/// Built once per stop by Process::stopSnapshot, and shared by everything displaying the stop.
+/// Out of range indices give empty values, and a null thread.
+/// \expose sharedpointer
+class StopSnapshot
+  {
+  SHARED_CLASS(StopSnapshot);
+  PIMPL_CLASS(StopSnapshot, sizeof(void*) * 8);
+
+public:
+  /// \noexpose
+  StopSnapshot();
+  ~StopSnapshot();
+
+  /// \noexpose
+  static Pointer capture(Process &process, size_t maxFrames);
+
+  size_t threadCount() const;
+  std::shared_ptr<Thread> thread(size_t thread) const;
+  size_t threadID(size_t thread) const;
+  Eks::String threadName(size_t thread) const;
+
+  /// Index of the selected thread, or threadCount() if there is none.
+  size_t selectedThread() const;
+
+  /// Number of frames captured for [thread], at most the frame limit passed to capture.
+  size_t frameCount(size_t thread) const;
+  /// Number of frames the thread really has.
+  size_t totalFrameCount(size_t thread) const;
+  /// Index of the selected frame in [thread], or frameCount(thread) if it wasn't captured.
+  size_t selectedFrame(size_t thread) const;
+
+  Frame frame(size_t thread, size_t frame) const;
+  Eks::String functionName(size_t thread, size_t frame) const;
+  Eks::String filename(size_t thread, size_t frame) const;
+  bool hasLineNumber(size_t thread, size_t frame) const;
+  size_t lineNumber(size_t thread, size_t frame) const;
+  };
+
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include "Global.h"
+#include "Containers/XStringSimple.h"
+#include "Containers/XVector.h"
+
+namespace LldbDriver
+{
+
+class Target;
+class Module;
+class SymbolMatch;
+
+/// Searchable list of the functions, data and types in every module of a target.
+/// Functions and data are read from each module's symbol table and compile units on a background
+/// thread, a batch at a time so the module is never locked for long. Types are added as the
+/// TypeManager loads them, rather than parsing every module's types a second time.
+/// Queries rank fuzzy matches against the names indexed so far, without calling back
+/// into lldb until the results are known.
+/// \expose sharedpointer
+class SymbolIndex
+  {
+  SHARED_CLASS(SymbolIndex);
+  PIMPL_CLASS(SymbolIndex, sizeof(void*) * 96);
+
+public:
+  /// \noexpose
+  SymbolIndex();
+  ~SymbolIndex();
+
+  /// Start indexing the modules [target] has now.
+  /// \noexpose
+  static Pointer create(const std::shared_ptr<Target> &target);
+
+  /// Start indexing any modules the target has loaded since the index was created or last refreshed.
+  void refresh();
+
+  /// Add the type [name], declared by [module] in [file] at [line], or at line 0 if it isn't known.
+  /// \noexpose
+  void addType(const std::shared_ptr<Module> &module, const char *name, const char *file, size_t line);
+
+  /// True once no modules are waiting to be indexed.
+  bool isReady() const;
+  size_t symbolCount() const;
+
+  /// Find the best [maxResults] matches for [query], best first.
+  Eks::Vector<SymbolMatch> find(const char *query, size_t maxResults) const;
+  };
+
+/// A single result from SymbolIndex::find.
+/// \expose
+class SymbolMatch
+  {
+public:
+  /// \noexpose
+  SymbolMatch();
+
+  Eks::String name() const { return _name; }
+  Eks::String modulePath() const { return _modulePath; }
+  Eks::String filename() const { return _filename; }
+  bool hasLineNumber() const { return _hasLineNumber; }
+  size_t lineNumber() const { return _lineNumber; }
+  bool isType() const { return _isType; }
+  int score() const { return _score; }
+
+private:
+  Eks::String _name;
+  Eks::String _modulePath;
+  Eks::String _filename;
+  bool _hasLineNumber;
+  size_t _lineNumber;
+  bool _isType;
+  int _score;
+
+  friend class SymbolIndex;
+  };
+
+}
@@ -2,24 +2,63 @@
 #include "Global.h"
 #include "Utilities/XStringRef.h"
 #include "Utilities/XNotifier.h"
+#include "Containers/XVector.h"
+#include "Containers/XStringSimple.h"
+#include <vector>
 
 namespace LldbDriver
 {
 
 class Process;
+enum class StdioMode;
 class Module;
 class Error;
 class Breakpoint;
 class BreakpointLocation;
 
+/// A change to one breakpoint, delivered to Target::breakpointsChanged listeners.
+/// \expose
+class BreakpointChange
+  {
+public:
+  /// \expose
+  enum class Type
+    {
+    Added,
+    Removed,
+    EnabledChanged,
+    LocationsChanged,
+    Modified
+    };
+
+  /// \noexpose
+  BreakpointChange();
+
+  Type type() const { return _type; }
+  size_t breakpoint() const { return _breakpoint; }
+
+  /// Ids of the locations lldb reported as added, removed or resolved, for LocationsChanged.
+  Eks::Vector<int> locations() const;
+  /// Files which had or now have a location of the breakpoint, so their markers may need updating.
+  Eks::Vector<Eks::String> files() const;
+
+private:
+  Type _type;
+  size_t _breakpoint;
+  std::vector<int> _locations;
+  std::vector<std::shared_ptr<const Eks::String>> _files;
+
+  friend class Target;
+  };
+
 /// \expose unmanaged
-X_DECLARE_NOTIFIER(BreakpointNotifier, std::function<void ()>);
+X_DECLARE_NOTIFIER(BreakpointNotifier, std::function<void (const BreakpointChange &)>);
 
 /// \expose sharedpointer
 class Target
   {
   SHARED_CLASS(Target);
-  PIMPL_CLASS(Target, 64);
+  PIMPL_CLASS(Target, sizeof(void*) * 48);
 
 public:
   /// \noexpose
@@ -32,6 +71,9 @@ public:
     const Eks::Vector<Eks::StringRef> &args,
     const Eks::Vector<Eks::StringRef> &env,
     Error &err);
+  /// Where the standard streams of processes launched from now on go.
+  StdioMode stdioMode() const;
+  void setStdioMode(StdioMode mode);
   std::shared_ptr<Process> attach(uint64_t pid, Error &err);
   std::shared_ptr<Process> connect(const Eks::String &url, Error &err);
 
@@ -40,19 +82,29 @@ public:
   std::shared_ptr<Module> moduleAt(size_t index);
 
   BreakpointNotifier *breakpointsChanged() { return &_breakpointsChanged; }
+  /// Deliver breakpoint changes lldb has reported since the last call to breakpointsChanged.
+  void processEvents();
 
   /// \param[out] outBrk the found breakpoint
   /// \param[out] outLoc the found breakpoint location
   bool findBreakpoint(const Eks::String &file, size_t line, Breakpoint *outBrk, BreakpointLocation *outLoc);
+  /// Find the lines in [file] with a breakpoint location, in no particular order.
+  Eks::Vector<size_t> breakpointLines(const Eks::String &file);
   Breakpoint addBreakpoint(const Eks::String &file, size_t line);
   bool removeBreakpoint(const Breakpoint &brk);
 
   size_t breakpointCount();
   Breakpoint breakpointAt(size_t index);
+  /// Find the breakpoint with [id], the result is invalid if there isn't one.
+  Breakpoint breakpointWithId(size_t id);
+
+  /// Take the lines written by breakpoint log actions since the last call.
+  Eks::String takeBreakpointLog();
 
 private:
   BreakpointNotifier _breakpointsChanged;
   friend class Debugger;
+  friend class Breakpoint;
   };
 
 }
@@ -80,6 +80,7 @@ public:
   Value stopReturnValue() const;
 
   friend class Process;
+  friend class StopSnapshot;
   };
 
 }
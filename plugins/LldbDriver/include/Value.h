@@ -1,15 +1,20 @@
 #pragma once
 #include "Global.h"
+#include "Containers/XVector.h"
+#include "Containers/XStringSimple.h"
 
 namespace LldbDriver
 {
 
 class Type;
+class ValueSummary;
+class ArrayStatistics;
+class ContiguousArray;
 
 /// \expose
 class Value
   {
-  PIMPL_CLASS(Value, sizeof(void*) * 8);
+  PIMPL_CLASS(Value, sizeof(void*) * 12);
 
 public:
   /// \noexpose
@@ -35,11 +40,76 @@ public:
   size_t childCount() const;
   Value childAt(size_t i) const;
 
+  /// Find up to [count] children, starting at [start].
+  Eks::Vector<Value> children(size_t start, size_t count) const;
+  /// Describe up to [count] children, starting at [start], in one call.
+  Eks::Vector<ValueSummary> summaries(size_t start, size_t count) const;
+
+  /// True if the value holds a block of numbers in memory - a C array, std::array, std::vector or QVector -
+  /// in which case its children are the elements, read in one transfer and formatted without lldb.
+  bool isContiguousArray() const;
+  /// Treat this pointer as the first of [count] elements, as a contiguous array if they are numbers.
+  Value asArray(size_t count) const;
+  /// Read every element of a contiguous array and summarise them, invalid for any other value.
+  ArrayStatistics statistics() const;
+
   Value evaluate(const char *name, const char *) const;
   Value evaluateChild(const char *) const;
 
+private:
+  Eks::Vector<ValueSummary> arraySummaries(const ContiguousArray &array, size_t start, size_t count) const;
+
   friend class Frame;
   friend class Thread;
   };
 
+/// The parts of a value needed to display it, collected by Value::summaries.
+/// \expose
+class ValueSummary
+  {
+public:
+  /// \noexpose
+  ValueSummary();
+
+  Value child() const { return _child; }
+  Eks::String name() const { return _name; }
+  Eks::String typeName() const { return _typeName; }
+  Eks::String value() const { return _value; }
+  bool mightHaveChildren() const { return _mightHaveChildren; }
+
+private:
+  Value _child;
+  Eks::String _name;
+  Eks::String _typeName;
+  Eks::String _value;
+  bool _mightHaveChildren;
+
+  friend class Value;
+  };
+
+/// Summary of the elements of a contiguous array, collected by Value::statistics.
+/// \expose
+class ArrayStatistics
+  {
+public:
+  /// \noexpose
+  ArrayStatistics();
+
+  bool isValid() const { return _valid; }
+  size_t count() const { return _count; }
+  double minimum() const { return _minimum; }
+  double maximum() const { return _maximum; }
+  double sum() const { return _sum; }
+  double mean() const { return _count ? _sum / _count : 0.0; }
+
+private:
+  bool _valid;
+  size_t _count;
+  double _minimum;
+  double _maximum;
+  double _sum;
+
+  friend class ContiguousArray;
+  };
+
 }
@@ -0,0 +1,109 @@
+#pragma once
+#include "Global.h"
+#include "Evaluator.h"
+#include "Value.h"
+#include "Containers/XStringSimple.h"
+#include "Containers/XVector.h"
+#include <functional>
+
+namespace LldbDriver
+{
+
+class Frame;
+class WatchResult;
+
+/// A list of watch expressions, evaluated together in one batch each time the process stops.
+/// Evaluation runs on a background thread, in the order the watches were added, and each result
+/// is reported as it is found. Results from an earlier stop are kept, marked stale, until replaced.
+/// Only variable paths are evaluated unless the evaluator's policy is set to RunTarget, as running
+/// the target from the evaluation thread competes with everything else reading the stopped process.
+/// \expose sharedpointer
+class WatchSet
+  {
+  SHARED_CLASS(WatchSet);
+  PIMPL_CLASS(WatchSet, sizeof(void*) * 48);
+
+public:
+  /// Passed to the result callback when a batch has finished with its frame, rather than a watch id.
+  static const size_t BatchFinished = ~(size_t)0;
+
+  /// \noexpose
+  WatchSet();
+  ~WatchSet();
+
+  static Pointer create();
+
+  /// The evaluator used for every watch, to set its policy and timeout. Its policy starts as VariablesOnly.
+  Evaluator::Pointer evaluator() const;
+
+  /// Add [expression], returning an id for it. It is evaluated at the next call to evaluate.
+  size_t add(const char *expression);
+  void remove(size_t id);
+  void setExpression(size_t id, const char *expression);
+
+  Eks::Vector<size_t> ids() const;
+  Eks::String expression(size_t id) const;
+
+  /// Start evaluating every watch in [frame], abandoning any batch still running.
+  void evaluate(const Frame &frame);
+  /// Mark every result stale, when the process resumes and they no longer describe it.
+  void markStale();
+  /// True while a batch is being evaluated.
+  bool isEvaluating() const;
+
+  WatchResult result(size_t id) const;
+
+  /// Set a function called from the evaluation thread with each watch id as its result is found,
+  /// and with BatchFinished when a finished batch leaves a frame to be released.
+  /// It should hand the id over to the owning thread, and mustn't call back into the set.
+  /// \noexpose
+  void setResultCallback(const std::function<void (size_t)> &fn);
+  /// Release the frames finished batches have left, which may be the last references to their process.
+  /// Call from the owning thread, so the process isn't destroyed on the evaluation thread.
+  /// evaluate and markStale do this too.
+  /// \noexpose
+  void releaseFrames();
+  };
+
+/// The value of a watch, as last evaluated by a WatchSet.
+/// \expose
+class WatchResult
+  {
+public:
+  /// \noexpose
+  WatchResult();
+
+  Eks::String expression() const { return _expression; }
+  Value value() const { return _value; }
+  Eks::String valueString() const { return _valueString; }
+  Eks::String typeName() const { return _typeName; }
+  Eks::String error() const { return _error; }
+
+  /// True until the watch has been evaluated.
+  bool isPending() const { return _pending; }
+  /// True if the result is from an earlier stop than the current one.
+  bool isStale() const { return _stale; }
+  EvaluationMethod method() const { return _method; }
+  /// How long the last evaluation took, in microseconds.
+  size_t cost() const { return _cost; }
+  /// Total time spent evaluating the watch, over every stop, in microseconds.
+  size_t totalCost() const { return _totalCost; }
+  size_t evaluationCount() const { return _evaluationCount; }
+
+private:
+  Eks::String _expression;
+  Value _value;
+  Eks::String _valueString;
+  Eks::String _typeName;
+  Eks::String _error;
+  bool _pending;
+  bool _stale;
+  EvaluationMethod _method;
+  size_t _cost;
+  size_t _totalCost;
+  size_t _evaluationCount;
+
+  friend class WatchSet;
+  };
+
+}
@@ -2,10 +2,22 @@
 #include "Breakpoint.h"
 #include "Target.h"
 #include "lldb/API/SBBreakpoint.h"
+#include <vector>
 
 class LldbDriver::Breakpoint::Impl
   {
 public:
+  /// Resolved locations, shared by every Breakpoint wrapping the same lldb breakpoint.
+  /// The target marks them stale when lldb reports the breakpoint changed.
+  struct Locations
+    {
+    bool resolved = false;
+    std::vector<BreakpointLocation> locations;
+    };
+
   Target::Pointer target;
   lldb::SBBreakpoint breakpoint;
+  std::shared_ptr<Locations> locations;
+
+  const std::vector<BreakpointLocation> &resolvedLocations();
   };
@@ -0,0 +1,83 @@
+#pragma once
+#include "Value.h"
+#include "lldb/API/SBProcess.h"
+#include "lldb/API/SBType.h"
+#include "lldb/API/SBValue.h"
+#include <vector>
+
+namespace LldbDriver
+{
+
+/// Where a value keeps a block of primitive elements - a C array, std::array, std::vector,
+/// QVector or a pointer given a length - so they can be read in one transfer and decoded
+/// here, rather than asking lldb for a value per element.
+class ContiguousArray
+  {
+public:
+  enum Layout
+    {
+    None,
+    Array,
+    Pointer,
+    Vector,
+    QtVector
+    };
+
+  enum Element
+    {
+    Unknown,
+    Bool,
+    Int8,
+    UInt8,
+    Int16,
+    UInt16,
+    Int32,
+    UInt32,
+    Int64,
+    UInt64,
+    Float,
+    Double
+    };
+
+  enum
+    {
+    // Larger counts are taken to be an uninitialised container, not a real one.
+    MaxElements = 1 << 28,
+    // Elements read at once when summarising.
+    ChunkBytes = 4 * 1024 * 1024
+    };
+
+  ContiguousArray();
+
+  /// Work out how [value] stores its elements, this only depends on the type so is done once per value.
+  void detect(lldb::SBValue value);
+  /// Treat [value], a pointer, as the first of [count] elements.
+  void setPointer(lldb::SBValue value, size_t count);
+
+  bool isValid() const { return _layout != None; }
+  lldb::SBType elementType() const { return _elementType; }
+  size_t elementSize() const { return _elementSize; }
+
+  /// Find where the elements of [value] are now, they move as containers grow.
+  bool locate(lldb::SBValue value, uint64_t &address, size_t &count) const;
+
+  /// Read elements [start, start + count) of [value] into [bytes] in one transfer, returning the number read.
+  size_t read(lldb::SBValue value, size_t start, size_t count, std::vector<uint8_t> &bytes) const;
+
+  Eks::String format(const uint8_t *element) const;
+
+  /// Read every element of [value], a chunk at a time, and summarise them.
+  ArrayStatistics statistics(lldb::SBValue value) const;
+
+private:
+  bool setElementType(lldb::SBType type);
+
+  Layout _layout;
+  Element _element;
+  bool _character;
+  size_t _elementSize;
+  size_t _pointerCount;
+  lldb::SBType _elementType;
+  };
+
+}
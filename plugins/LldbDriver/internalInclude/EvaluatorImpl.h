@@ -0,0 +1,55 @@
+#pragma once
+#include "Evaluator.h"
+#include "lldb/API/SBExpressionOptions.h"
+#include "lldb/API/SBFrame.h"
+#include "lldb/API/SBValue.h"
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+class LldbDriver::Evaluator::Impl
+  {
+public:
+  enum
+    {
+    DefaultTimeout = 500 * 1000,
+    // Contexts come and go as the program is stepped through, start again rather than grow forever.
+    MaxEntries = 1024
+    };
+
+  struct Entry
+    {
+    EvaluationMethod method = EvaluationMethod::None;
+    lldb::SBValue result;
+    std::string error;
+    // The frame, stop, pc and innermost block the result was found at.
+    lldb::addr_t cfa = 0;
+    uint32_t stopId = 0;
+    lldb::addr_t pc = 0;
+    lldb::addr_t block = LLDB_INVALID_ADDRESS;
+    };
+
+  /// Options for evaluating expressions in a debugger UI: don't stop at breakpoints, clean up after errors,
+  /// only run the stopped thread then all threads up to [timeout], and don't create $ result variables.
+  static lldb::SBExpressionOptions options(size_t timeout)
+    {
+    lldb::SBExpressionOptions opts;
+    opts.SetFetchDynamicValue(lldb::eNoDynamicValues);
+    opts.SetUnwindOnError(true);
+    opts.SetIgnoreBreakpoints(true);
+    opts.SetTimeoutInMicroSeconds((uint32_t)timeout);
+    opts.SetTryAllThreads(true);
+    opts.SetSuppressPersistentResult(true);
+    return opts;
+    }
+
+  static bool isVariablePath(const char *expression);
+  static lldb::addr_t blockStart(const lldb::SBFrame &frame);
+
+  mutable std::mutex lock;
+  EvaluationPolicy policy = EvaluationPolicy::RunTarget;
+  size_t timeout = DefaultTimeout;
+
+  // Keyed by function name then expression, separated by a null.
+  std::unordered_map<std::string, Entry> entries;
+  };
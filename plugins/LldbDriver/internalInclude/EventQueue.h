@@ -0,0 +1,104 @@
+#pragma once
+#include <atomic>
+#include <utility>
+
+namespace LldbDriver
+{
+
+/// Unbounded lock free queue, safe for many producers and a single consumer.
+/// Used to pass decoded events from driver threads to the thread owning the UI.
+template <typename T> class EventQueue
+  {
+public:
+  EventQueue()
+      : _head(&_stub),
+        _tail(&_stub)
+    {
+    _stub.next.store(nullptr, std::memory_order_relaxed);
+    }
+
+  ~EventQueue()
+    {
+    T discard;
+    while (pop(discard))
+      {
+      }
+    }
+
+  EventQueue(const EventQueue &) = delete;
+  EventQueue &operator=(const EventQueue &) = delete;
+
+  void push(T &&val)
+    {
+    auto node = new Node;
+    node->value = std::move(val);
+    node->next.store(nullptr, std::memory_order_relaxed);
+
+    enqueue(node);
+    }
+
+  bool pop(T &out)
+    {
+    Node *tail = _tail;
+    Node *next = tail->next.load(std::memory_order_acquire);
+
+    if (tail == &_stub)
+      {
+      if (!next)
+        {
+        return false;
+        }
+
+      _tail = next;
+      tail = next;
+      next = next->next.load(std::memory_order_acquire);
+      }
+
+    if (next)
+      {
+      _tail = next;
+      out = std::move(tail->value);
+      delete tail;
+      return true;
+      }
+
+    if (tail != _head.load(std::memory_order_acquire))
+      {
+      // A producer is part way through a push, try again next drain.
+      return false;
+      }
+
+    _stub.next.store(nullptr, std::memory_order_relaxed);
+    enqueue(&_stub);
+
+    next = tail->next.load(std::memory_order_acquire);
+    if (next)
+      {
+      _tail = next;
+      out = std::move(tail->value);
+      delete tail;
+      return true;
+      }
+
+    return false;
+    }
+
+private:
+  struct Node
+    {
+    std::atomic<Node *> next;
+    T value;
+    };
+
+  void enqueue(Node *node)
+    {
+    Node *prev = _head.exchange(node, std::memory_order_acq_rel);
+    prev->next.store(node, std::memory_order_release);
+    }
+
+  std::atomic<Node *> _head;
+  Node *_tail;
+  Node _stub;
+  };
+
+}
@@ -1,3 +1,4 @@
+#pragma once
 #include "Frame.h"
 #include "lldb/API/SBFrame.h"
 #include "Thread.h"
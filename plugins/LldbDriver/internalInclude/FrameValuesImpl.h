@@ -0,0 +1,37 @@
+#pragma once
+#include "FrameValues.h"
+#include "lldb/API/SBProcess.h"
+#include "lldb/API/SBValue.h"
+#include <string>
+#include <vector>
+
+class LldbDriver::FrameValues::Impl
+  {
+public:
+  struct Entry
+    {
+    lldb::SBValue value;
+    bool argument;
+    // Where the value lives in the inferior, or LLDB_INVALID_ADDRESS if it is in registers.
+    lldb::addr_t address;
+    size_t size;
+    std::vector<uint8_t> bytes;
+    // Shown in place of the bytes for strings and the like, and read from memory they point to.
+    std::string summary;
+    };
+
+  void add(const lldb::SBValueList &values, bool argument);
+  void read(lldb::SBProcess process);
+  static void readData(Entry &entry, std::vector<uint8_t> &bytes);
+
+  bool valid = false;
+  lldb::addr_t cfa = 0;
+  std::string function;
+
+  std::vector<Entry> entries;
+  std::vector<size_t> changed;
+
+  // Reused between updates, the variables of one frame are read in a single block where possible.
+  std::vector<uint8_t> block;
+  std::vector<uint8_t> scratch;
+  };
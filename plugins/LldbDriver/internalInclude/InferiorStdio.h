@@ -0,0 +1,87 @@
+#pragma once
+#include "Process.h"
+#include "lldb/API/SBError.h"
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace LldbDriver
+{
+
+/// Standard streams of a launched process, owned by Debugify rather than proxied through lldb.
+/// A reader thread drains the inferior's output with large reads as soon as it is written,
+/// so a chatty process isn't throttled by lldb's event broadcasts. Once a few megabytes are
+/// waiting to be drained the reader stops, and the inferior blocks writing until there is room.
+class InferiorStdio
+  {
+public:
+  /// Called from the reader thread when a stream goes from empty to having output waiting.
+  typedef std::function<void (Process::OutputType)> Callback;
+
+  /// Create the pipes or terminal for [mode], which must not be StdioMode::Debugger.
+  static std::unique_ptr<InferiorStdio> create(StdioMode mode, lldb::SBError &error);
+  ~InferiorStdio();
+
+  /// Paths to pass to lldb's launch for each stream.
+  const char *stdinPath() const { return _stdinPath.c_str(); }
+  const char *stdoutPath() const { return _stdoutPath.c_str(); }
+  const char *stderrPath() const { return _stderrPath.c_str(); }
+
+  /// Start reading once the process has been launched.
+  void start(const Callback &cb);
+
+  /// Copy up to [size] bytes of waiting output into [data].
+  size_t read(Process::OutputType type, char *data, size_t size);
+  /// Move all waiting output onto the end of [buffer], without copying if it is empty.
+  size_t drain(Process::OutputType type, std::vector<char> &buffer);
+
+  /// Write [size] bytes to the process' stdin, returns the number written.
+  size_t write(const char *data, size_t size);
+
+private:
+  struct Stream
+    {
+    int fd = -1;
+    // Output waiting to be drained, guarded by _lock.
+    std::vector<char> buffer;
+    // Only touched by the reader thread, which reads into it without holding the lock.
+    std::vector<char> incoming;
+    };
+
+  InferiorStdio(StdioMode mode);
+
+  bool createPipes(lldb::SBError &error);
+  bool createPty(lldb::SBError &error);
+  void readLoop();
+  bool readStream(Stream &stream);
+
+  Stream &stream(Process::OutputType type)
+    {
+    // A terminal only has one stream, stderr is written to it and the error stream stays empty.
+    return type == Process::OutputType::Error ? _error : _output;
+    }
+
+  StdioMode _mode;
+  std::string _directory;
+  std::string _stdinPath;
+  std::string _stdoutPath;
+  std::string _stderrPath;
+
+  int _input;
+  // Descriptors held open so reads don't see end of file before the inferior opens its end.
+  std::vector<int> _keepOpen;
+
+  std::mutex _lock;
+  Stream _output;
+  Stream _error;
+  Callback _callback;
+
+  std::atomic<bool> _quit;
+  std::thread _reader;
+  };
+
+}
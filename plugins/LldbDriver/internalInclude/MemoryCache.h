@@ -0,0 +1,93 @@
+#pragma once
+#include "lldb/API/SBProcess.h"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace LldbDriver
+{
+
+/// Whole pages of a stopped process' memory, read a run of pages at a time and kept until
+/// the process resumes or stops somewhere else. Reads can be made from any thread, and the
+/// process is read without holding the cache's lock, so a long read ahead doesn't hold up
+/// reads of pages already cached. Asynchronous reads are made in order on a single reader thread.
+class MemoryCache
+  {
+public:
+  typedef std::function<void (uint64_t address, const uint8_t *data, size_t size)> ChunkCallback;
+
+  enum
+    {
+    PageSize = 4096,
+    // Missing pages are read at least this many at once, so walking through memory mostly hits pages read ahead.
+    ReadAheadPages = 16,
+    // The most read in one request, larger reads are split.
+    MaxRunPages = 256,
+    MaxPages = 4096
+    };
+
+  MemoryCache();
+  ~MemoryCache();
+
+  /// Drop every page, and any reads queued. Called whenever the process resumes.
+  void invalidate();
+
+  /// Copy up to [size] bytes at [address] into [data], stopping at the first unreadable page.
+  size_t read(lldb::SBProcess process, uint64_t address, uint8_t *data, size_t size);
+
+  /// Queue a read of [size] bytes at [address], calling [chunk] on the reader thread with each [chunkSize] block.
+  /// [chunk] may be empty to only fill the cache.
+  void readAsync(lldb::SBProcess process, uint64_t address, size_t size, size_t chunkSize, const ChunkCallback &chunk);
+
+  /// Drop any queued reads, and wait for the one in progress to stop. Not to be called from a chunk callback.
+  void cancel();
+
+private:
+  struct Page
+    {
+    bool readable;
+    std::vector<uint8_t> bytes;
+    std::list<uint64_t>::iterator used;
+    };
+
+  struct Job
+    {
+    lldb::SBProcess process;
+    uint64_t address;
+    size_t size;
+    size_t chunkSize;
+    ChunkCallback chunk;
+    uint64_t generation;
+    };
+
+  size_t missingRun(uint64_t address, size_t wanted) const;
+  static size_t readRun(lldb::SBProcess &process, uint64_t address, size_t count, std::vector<uint8_t> &buffer, bool &failedReadable);
+  void storeRun(uint64_t address, size_t count, const std::vector<uint8_t> &buffer, size_t whole, bool failedReadable);
+  void store(uint64_t address, const uint8_t *data, bool readable);
+  void clearPages();
+  void run();
+
+  std::mutex _lock;
+  std::unordered_map<uint64_t, Page> _pages;
+  // Page addresses, most recently used first.
+  std::list<uint64_t> _used;
+  // The stop the pages were read at. A step can stop again before the gui sees the
+  // state change that invalidates the cache, so reads check it themselves.
+  uint32_t _stopId;
+  // Bumped on invalidate and cancel, so a read in progress knows to stop.
+  uint64_t _generation;
+
+  std::deque<Job> _jobs;
+  std::condition_variable _wake;
+  std::condition_variable _idle;
+  bool _busy;
+  bool _quit;
+  std::thread _reader;
+  };
+
+}
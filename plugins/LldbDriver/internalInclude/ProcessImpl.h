@@ -1,9 +1,19 @@
+#pragma once
 #include "Process.h"
 #include "Thread.h"
 #include "ThreadImpl.h"
+#include "EventQueue.h"
+#include "InferiorStdio.h"
+#include "MemoryCache.h"
 #include "lldb/API/SBProcess.h"
 #include "lldb/API/SBListener.h"
+#include "lldb/API/SBEvent.h"
+#include "lldb/API/SBBreakpoint.h"
+#include "lldb/API/SBTarget.h"
 #include "Target.h"
+#include "StopSnapshot.h"
+#include <thread>
+#include <mutex>
 
 template <> struct std::hash<lldb::SBThread>
   {
@@ -21,6 +31,29 @@ public:
     {
     }
 
+  ~Impl()
+    {
+    stdio.reset();
+    stopListening();
+    }
+
+  /// An event decoded on the listener thread, waiting to be delivered.
+  struct Event
+    {
+    enum Type
+      {
+      StateChanged,
+      Output,
+      Error,
+      BreakpointLog,
+      // The target's breakpoints changed, Target::processEvents delivers the change itself.
+      BreakpointsChanged
+      };
+
+    Type type = StateChanged;
+    lldb::StateType state = lldb::eStateInvalid;
+    };
+
   std::weak_ptr<LldbDriver::Process> myself;
   Target::Pointer target;
   lldb::SBProcess process;
@@ -29,8 +62,109 @@ public:
   NoArgNotifier ended;
   NoArgNotifier outputAvailable;
   NoArgNotifier errorAvailable;
+  NoArgNotifier breakpointLogAvailable;
   lldb::SBListener listener;
 
+  // Reused by getOutputs, so draining doesn't allocate once they have grown.
+  std::vector<char> outputBuffer;
+  std::vector<char> errorBuffer;
+
+  // Set when launched with streams Debugify reads itself, rather than through lldb.
+  std::unique_ptr<InferiorStdio> stdio;
+
+  // Pages of memory read since the last stop.
+  MemoryCache memory;
+
+  // Frames captured per thread by stopSnapshot.
+  const size_t snapshotFrameLimit = 128;
+  StopSnapshot::Pointer snapshot;
+
+  EventQueue<Event> events;
+  std::atomic<bool> eventsPending { false };
+  std::atomic<bool> quitListening { false };
+  std::thread listenerThread;
+
+  std::mutex eventCallbackLock;
+  std::function<void ()> eventCallback;
+
+  void startListening()
+    {
+    stopListening();
+
+    // Breakpoints resolved as a library loads are reported to the target, and lldb resumes
+    // without a process event, so wake up for those too rather than waiting for the next stop.
+    listener.StartListeningForEvents(process.GetTarget().GetBroadcaster(), lldb::SBTarget::eBroadcastBitBreakpointChanged);
+
+    quitListening = false;
+    listenerThread = std::thread([this]() { listen(); });
+    }
+
+  void stopListening()
+    {
+    quitListening = true;
+    if (listenerThread.joinable())
+      {
+      listenerThread.join();
+      }
+    }
+
+  void listen()
+    {
+    // Wake up periodically to notice when we are asked to stop.
+    const uint32_t timeoutSeconds = 1;
+
+    lldb::SBEvent ev;
+    while (!quitListening)
+      {
+      if (!listener.WaitForEvent(timeoutSeconds, ev))
+        {
+        continue;
+        }
+
+      Event decoded;
+      if (ev.GetType() == lldb::SBProcess::eBroadcastBitSTDOUT)
+        {
+        decoded.type = Event::Output;
+        }
+      else if (ev.GetType() == lldb::SBProcess::eBroadcastBitSTDERR)
+        {
+        decoded.type = Event::Error;
+        }
+      else if (lldb::SBProcess::EventIsProcessEvent(ev) &&
+               (ev.GetType() & lldb::SBProcess::eBroadcastBitStateChanged) != 0)
+        {
+        decoded.type = Event::StateChanged;
+        decoded.state = lldb::SBProcess::GetStateFromEvent(ev);
+        }
+      else if (lldb::SBBreakpoint::EventIsBreakpointEvent(ev))
+        {
+        decoded.type = Event::BreakpointsChanged;
+        }
+      else
+        {
+        continue;
+        }
+
+      post(std::move(decoded));
+      }
+    }
+
+  /// Queue [ev] for processEvents, safe to call from any thread.
+  void post(Event &&ev)
+    {
+    events.push(std::move(ev));
+
+    // Only the first event of a batch needs to wake the consumer, it drains everything queued.
+    if (!eventsPending.exchange(true))
+      {
+      std::lock_guard<std::mutex> l(eventCallbackLock);
+      if (eventCallback)
+        {
+        eventCallback();
+        }
+      }
+    }
+
   std::shared_ptr<LldbDriver::Thread> wrapThread(const lldb::SBThread &thr)
     {
     auto fnd = threads.find(thr);
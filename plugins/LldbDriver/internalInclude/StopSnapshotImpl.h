@@ -0,0 +1,56 @@
+#pragma once
+#include "StopSnapshot.h"
+#include "Containers/XStringSimple.h"
+#include "lldb/API/SBThread.h"
+#include "lldb/API/SBFrame.h"
+#include <vector>
+
+/// Holds the raw lldb handles rather than Thread or Frame, which own their Process -
+/// the Process caches its snapshot, and would otherwise never be destroyed while stopped.
+class LldbDriver::StopSnapshot::Impl
+  {
+public:
+  struct FrameData
+    {
+    lldb::SBFrame frame;
+    Eks::String functionName;
+    Eks::String filename;
+    bool hasLineNumber;
+    size_t lineNumber;
+    };
+
+  struct ThreadData
+    {
+    lldb::SBThread thread;
+    size_t id;
+    Eks::String name;
+    size_t totalFrames;
+    size_t selectedFrame;
+    std::vector<FrameData> frames;
+    };
+
+  const ThreadData *findThread(size_t thread) const
+    {
+    if (thread >= threads.size())
+      {
+      return nullptr;
+      }
+
+    return &threads[thread];
+    }
+
+  const FrameData *findFrame(size_t thread, size_t frame) const
+    {
+    auto data = findThread(thread);
+    if (!data || frame >= data->frames.size())
+      {
+      return nullptr;
+      }
+
+    return &data->frames[frame];
+    }
+
+  std::weak_ptr<Process> process;
+  size_t selectedThread = 0;
+  std::vector<ThreadData> threads;
+  };
@@ -0,0 +1,107 @@
+#pragma once
+#include "SymbolIndex.h"
+#include "Module.h"
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class LldbDriver::SymbolIndex::Impl
+  {
+public:
+  enum Kind
+    {
+    Function,
+    Data,
+    Structure
+    };
+
+  enum
+    {
+    // Symbols read from a module per lock of it.
+    SymbolBatchSize = 4096,
+    NoSymbol = 0xFFFFFFFF
+    };
+
+  struct Entry
+    {
+    size_t name;
+    uint32_t length;
+    uint32_t module;
+    /// Symbol index in the module, or NoSymbol for entries found with their location.
+    uint32_t symbol;
+    /// Index into files and line of the declaration, for entries with no symbol.
+    uint32_t file;
+    uint32_t line;
+    Kind kind;
+    /// One bit per character (folded into 64) appearing in the name, to reject most entries with a single test.
+    uint64_t mask;
+    };
+
+  /// A name read from a module, stored once the module's lock is released.
+  struct Found
+    {
+    std::string name;
+    uint32_t symbol;
+    Kind kind;
+    std::string file;
+    uint32_t line;
+    };
+
+  ~Impl()
+    {
+    cancelled = true;
+    if (builder.joinable())
+      {
+      builder.join();
+      }
+    }
+
+  static uint64_t charMask(const char *str, size_t length)
+    {
+    uint64_t mask = 0;
+    for (size_t i = 0; i < length; ++i)
+      {
+      mask |= 1ULL << (str[i] & 63);
+      }
+    return mask;
+    }
+
+  void build();
+  void addModule(uint32_t index, const std::shared_ptr<Module> &module);
+  void store(uint32_t module, const std::vector<Found> &found);
+
+  // The rest are called with lock held.
+  uint32_t moduleIndex(const std::shared_ptr<Module> &module);
+  uint32_t fileIndex(const std::string &file);
+  void addName(const char *name, uint32_t module, uint32_t symbol, uint32_t file, uint32_t line, Kind kind);
+
+  std::weak_ptr<Target> target;
+
+  // Guards everything below, the builder appends to it while queries read it.
+  mutable std::mutex lock;
+
+  std::vector<std::shared_ptr<Module>> modules;
+  std::unordered_map<Module *, uint32_t> moduleIds;
+  std::deque<uint32_t> pending;
+  bool building = false;
+
+  // Names as found, and lowered for matching, both null separated and indexed by Entry::name.
+  std::vector<char> names;
+  std::vector<char> lowerNames;
+  std::vector<Entry> entries;
+  std::vector<Eks::String> files;
+  std::unordered_map<std::string, uint32_t> fileIds;
+  std::unordered_map<std::string, uint32_t> typeEntries;
+
+  // Typing extends the last query, so its matches, and anything added since, are all that needs scanning next time.
+  std::string lastQuery;
+  std::vector<uint32_t> lastMatches;
+  size_t lastEntryCount = 0;
+
+  std::atomic<bool> cancelled { false };
+  std::thread builder;
+  };
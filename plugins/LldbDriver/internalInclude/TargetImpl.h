@@ -1,7 +1,17 @@
 #include "Target.h"
 #include "ModuleImpl.h"
 #include "BreakpointImpl.h"
+#include "Process.h"
 #include "lldb/API/SBTarget.h"
+#include "lldb/API/SBListener.h"
+#include "lldb/API/SBEvent.h"
+#include "Utils.h"
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 class LldbDriver::Target::Impl
@@ -15,18 +25,35 @@ public:
 
   void cacheModules()
     {
-    if (modulesCached)
+    // Shared libraries load after launch, so the count is checked each time.
+    auto count = target.GetNumModules();
+    if (modulesCached && count == modules.size())
       {
       return;
       }
 
-    modules.clear();
-    for (size_t i = 0; i < target.GetNumModules(); ++i)
+    // Keep the wrappers of modules still loaded, others hold them by identity.
+    std::vector<std::shared_ptr<LldbDriver::Module>> previous;
+    previous.swap(modules);
+
+    for (size_t i = 0; i < count; ++i)
       {
+      auto sbModule = target.GetModuleAtIndex(i);
+      auto existing = std::find_if(previous.begin(), previous.end(), [&sbModule](const std::shared_ptr<LldbDriver::Module> &m)
+        {
+        return m->_impl->module == sbModule;
+        });
+
+      if (existing != previous.end())
+        {
+        modules.push_back(*existing);
+        continue;
+        }
+
       auto module = std::make_shared<Module>();
       module->_impl->myself = module;
       module->_impl->target = myself.lock();
-      module->_impl->module = target.GetModuleAtIndex(i);
+      module->_impl->module = sbModule;
 
       modules.push_back(module);
       }
@@ -40,6 +67,295 @@ public:
     breakpoint._impl->target = myself.lock();
     breakpoint._impl->breakpoint = br;
 
+    if (br.IsValid())
+      {
+      auto &locations = breakpointLocations[br.GetID()];
+      if (!locations)
+        {
+        locations = std::make_shared<LldbDriver::Breakpoint::Impl::Locations>();
+        }
+      breakpoint._impl->locations = locations;
+      }
+
     return breakpoint;
     }
+
+  typedef std::shared_ptr<const Eks::String> File;
+
+  /// Intern the path of [spec], so equal paths share one string.
+  File internFile(lldb::SBFileSpec spec)
+    {
+    // lldb's ConstStrings are unique per string, so a spec seen before is found without
+    // building the path or resolving it against the filesystem again.
+    auto key = std::make_pair(spec.GetDirectory(), spec.GetFilename());
+    auto found = fileSpecs.find(key);
+    if (found != fileSpecs.end())
+      {
+      return found->second;
+      }
+
+    Eks::String path = fileSpecAsString(spec);
+    auto &file = files[path.data()];
+    if (!file)
+      {
+      file = std::make_shared<const Eks::String>(path);
+      }
+
+    fileSpecs[key] = file;
+    return file;
+    }
+
+  /// Find the interned string for [path], or null if no location has used it.
+  const Eks::String *findFile(const Eks::String &path) const
+    {
+    auto found = files.find(path.data());
+    if (found == files.end())
+      {
+      return nullptr;
+      }
+
+    return found->second.get();
+    }
+
+  struct IndexedLocation
+    {
+    lldb::break_id_t breakpoint;
+    LldbDriver::BreakpointLocation location;
+    };
+
+  typedef std::unordered_map<uint32_t, std::vector<IndexedLocation>> LineLocations;
+  typedef std::pair<const Eks::String *, uint32_t> LocationKey;
+
+  std::unordered_map<std::string, File> files;
+  std::map<std::pair<const char *, const char *>, File> fileSpecs;
+
+  // Resolved locations for each breakpoint, shared with the Breakpoint wrappers.
+  std::unordered_map<lldb::break_id_t, std::shared_ptr<LldbDriver::Breakpoint::Impl::Locations>> breakpointLocations;
+
+  // Breakpoint locations by interned file and line, kept up to date from the target's breakpoint events.
+  lldb::SBListener breakpointListener;
+  bool breakpointsIndexed = false;
+  bool syncingBreakpoints = false;
+  // Changes seen while syncing, waiting for Target::processEvents to deliver them.
+  std::vector<LldbDriver::BreakpointChange> pendingChanges;
+  std::unordered_map<const Eks::String *, LineLocations> fileLocations;
+  // The file and line each breakpoint was indexed under, to remove it again.
+  std::unordered_map<lldb::break_id_t, std::vector<LocationKey>> breakpointKeys;
+
+  const LineLocations *findLocations(const Eks::String &file)
+    {
+    syncBreakpoints();
+
+    auto found = fileLocations.find(findFile(file));
+    if (found == fileLocations.end())
+      {
+      return nullptr;
+      }
+
+    return &found->second;
+    }
+
+  void syncBreakpoints()
+    {
+    // Indexing resolves locations, which syncs again.
+    if (syncingBreakpoints)
+      {
+      return;
+      }
+    syncingBreakpoints = true;
+
+    if (!breakpointsIndexed)
+      {
+      breakpointsIndexed = true;
+      breakpointListener = lldb::SBListener("BreakpointListener");
+      breakpointListener.StartListeningForEvents(target.GetBroadcaster(), lldb::SBTarget::eBroadcastBitBreakpointChanged);
+
+      for (uint32_t i = 0; i < target.GetNumBreakpoints(); ++i)
+        {
+        indexBreakpoint(target.GetBreakpointAtIndex(i));
+        }
+      }
+
+    lldb::SBEvent ev;
+    while (breakpointListener.GetNextEvent(ev))
+      {
+      if (!lldb::SBBreakpoint::EventIsBreakpointEvent(ev))
+        {
+        continue;
+        }
+
+      auto type = lldb::SBBreakpoint::GetBreakpointEventTypeFromEvent(ev);
+      auto br = lldb::SBBreakpoint::GetBreakpointFromEvent(ev);
+      auto id = br.GetID();
+
+      LldbDriver::BreakpointChange change;
+      change._type = changeType(type);
+      change._breakpoint = id;
+
+      auto locationCount = lldb::SBBreakpoint::GetNumBreakpointLocationsFromEvent(ev);
+      for (uint32_t i = 0; i < locationCount; ++i)
+        {
+        change._locations.push_back(lldb::SBBreakpoint::GetBreakpointLocationAtIndexFromEvent(ev, i).GetID());
+        }
+
+      // Files the breakpoint was in before the change...
+      auto locations = breakpointLocations.find(id);
+      if (locations != breakpointLocations.end())
+        {
+        addFiles(change, *locations->second);
+        locations->second->resolved = false;
+        }
+
+      if (type == lldb::eBreakpointEventTypeRemoved)
+        {
+        unindexBreakpoint(id);
+        if (locations != breakpointLocations.end())
+          {
+          breakpointLocations.erase(locations);
+          }
+        }
+      else
+        {
+        indexBreakpoint(br);
+
+        // ...and the files it is in now.
+        locations = breakpointLocations.find(id);
+        if (locations != breakpointLocations.end())
+          {
+          addFiles(change, *locations->second);
+          }
+        }
+
+      pendingChanges.push_back(std::move(change));
+      }
+
+    syncingBreakpoints = false;
+    }
+
+  static LldbDriver::BreakpointChange::Type changeType(lldb::BreakpointEventType type)
+    {
+    typedef LldbDriver::BreakpointChange::Type Type;
+    switch (type)
+      {
+    case lldb::eBreakpointEventTypeAdded:
+      return Type::Added;
+    case lldb::eBreakpointEventTypeRemoved:
+      return Type::Removed;
+    case lldb::eBreakpointEventTypeEnabled:
+    case lldb::eBreakpointEventTypeDisabled:
+      return Type::EnabledChanged;
+    case lldb::eBreakpointEventTypeLocationsAdded:
+    case lldb::eBreakpointEventTypeLocationsRemoved:
+    case lldb::eBreakpointEventTypeLocationsResolved:
+      return Type::LocationsChanged;
+    default:
+      return Type::Modified;
+      }
+    }
+
+  static void addFiles(LldbDriver::BreakpointChange &change, const LldbDriver::Breakpoint::Impl::Locations &locations)
+    {
+    if (!locations.resolved)
+      {
+      return;
+      }
+
+    xForeach(const auto &loc, locations.locations)
+      {
+      const auto &file = loc.internedFile();
+      if (file && std::find(change._files.begin(), change._files.end(), file) == change._files.end())
+        {
+        change._files.push_back(file);
+        }
+      }
+    }
+
+  void indexBreakpoint(const lldb::SBBreakpoint &br)
+    {
+    auto id = br.GetID();
+    unindexBreakpoint(id);
+
+    auto breakpoint = make(br);
+    auto &keys = breakpointKeys[id];
+
+    auto count = breakpoint.locationCount();
+    for (size_t i = 0; i < count; ++i)
+      {
+      auto loc = breakpoint.locationAt(i);
+      auto file = loc.internedFile().get();
+      if (!file || !file->length())
+        {
+        continue;
+        }
+
+      uint32_t line = (uint32_t)loc.line();
+      fileLocations[file][line].push_back(IndexedLocation{ id, loc });
+      keys.push_back(LocationKey(file, line));
+      }
+    }
+
+  void unindexBreakpoint(lldb::break_id_t id)
+    {
+    auto it = breakpointKeys.find(id);
+    if (it == breakpointKeys.end())
+      {
+      return;
+      }
+
+    xForeach(const auto &key, it->second)
+      {
+      auto &lines = fileLocations[key.first];
+      auto line = lines.find(key.second);
+      if (line == lines.end())
+        {
+        continue;
+        }
+
+      auto &locs = line->second;
+      locs.erase(std::remove_if(locs.begin(), locs.end(), [id](const IndexedLocation &l) { return l.breakpoint == id; }), locs.end());
+      if (locs.empty())
+        {
+        lines.erase(line);
+        }
+      }
+
+    breakpointKeys.erase(it);
+    }
+
+  /// A log message to write when a breakpoint is hit, passed to lldb as the callback baton.
+  struct BreakpointAction
+    {
+    Impl *target;
+    std::string message;
+    };
+
+  // Breakpoint callbacks run on lldb's thread, the lock guards the actions, log and process they use.
+  std::mutex actionLock;
+  std::unordered_map<lldb::break_id_t, std::unique_ptr<BreakpointAction>> actions;
+  std::string breakpointLog;
+  std::weak_ptr<LldbDriver::Process> process;
+
+  StdioMode stdioMode = StdioMode::Debugger;
+
+  void setProcess(const std::shared_ptr<LldbDriver::Process> &p)
+    {
+    std::lock_guard<std::mutex> l(actionLock);
+    process = p;
+    }
+
+  Eks::String logMessage(lldb::break_id_t id)
+    {
+    std::lock_guard<std::mutex> l(actionLock);
+    auto found = actions.find(id);
+    if (found == actions.end())
+      {
+      return Eks::String();
+      }
+    return found->second->message.c_str();
+    }
+
+  void setLogMessage(lldb::SBBreakpoint &br, const char *message);
+  void appendLog(const std::string &line);
+
+  static bool breakpointHit(void *baton, lldb::SBProcess &process, lldb::SBThread &thread, lldb::SBBreakpointLocation &location);
   };
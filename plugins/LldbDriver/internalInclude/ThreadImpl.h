@@ -1,3 +1,4 @@
+#pragma once
 #include "Thread.h"
 #include "FrameImpl.h"
 #include "Process.h"
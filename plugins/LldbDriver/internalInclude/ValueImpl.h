@@ -1,4 +1,5 @@
 #include "Value.h"
+#include "ContiguousArray.h"
 #include "lldb/API/SBValue.h"
 #include "Thread.h"
 
@@ -7,6 +8,20 @@ class LldbDriver::Value::Impl
 public:
   lldb::SBValue value;
 
+  // How the value lays out its elements, if it is a contiguous array. Found on first use.
+  mutable bool arrayDetected = false;
+  mutable ContiguousArray array;
+
+  const ContiguousArray &contiguousArray() const
+    {
+    if (!arrayDetected)
+      {
+      arrayDetected = true;
+      array.detect(value);
+      }
+    return array;
+    }
+
   static Value make(const lldb::SBValue &val)
     {
     Value v;
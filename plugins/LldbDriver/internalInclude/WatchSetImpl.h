@@ -0,0 +1,64 @@
+#pragma once
+#include "WatchSet.h"
+#include "Frame.h"
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class LldbDriver::WatchSet::Impl
+  {
+public:
+  struct Watch
+    {
+    std::string expression;
+    WatchResult result;
+    };
+
+  ~Impl()
+    {
+    {
+    std::lock_guard<std::mutex> l(lock);
+    quit = true;
+    ++generation;
+    }
+    wake.notify_all();
+
+    if (evaluator.joinable())
+      {
+      evaluator.join();
+      }
+    }
+
+  void run();
+  // Take the released frames out under the lock, to be destroyed once it's dropped.
+  std::vector<std::shared_ptr<Frame>> takeReleased()
+    {
+    std::vector<std::shared_ptr<Frame>> result;
+    std::lock_guard<std::mutex> l(lock);
+    result.swap(released);
+    return result;
+    }
+
+  Evaluator::Pointer expressions;
+
+  mutable std::mutex lock;
+  // Ordered by id, which is the order the watches were added.
+  std::map<size_t, Watch> watches;
+  size_t nextId = 0;
+
+  // The frame to evaluate in, and a count bumped for each batch so an abandoned one stops early.
+  std::shared_ptr<Frame> frame;
+  // Frames finished batches have replaced, left for the owning thread to release.
+  std::vector<std::shared_ptr<Frame>> released;
+  uint64_t generation = 0;
+  uint64_t evaluated = 0;
+  bool quit = false;
+  std::condition_variable wake;
+  std::thread evaluator;
+
+  std::mutex callbackLock;
+  std::function<void (size_t)> callback;
+  };
@@ -1,5 +1,6 @@
 #include "Breakpoint.h"
 #include "BreakpointImpl.h"
+#include "TargetImpl.h"
 #include "lldb/API/SBBreakpointLocation.h"
 #include "lldb/API/SBAddress.h"
 #include "Utils.h"
@@ -14,7 +15,7 @@ BreakpointLocation::BreakpointLocation()
   {
   }
 
-BreakpointLocation::BreakpointLocation(int id, const char *file, size_t line, bool resolved)
+BreakpointLocation::BreakpointLocation(int id, const std::shared_ptr<const Eks::String> &file, size_t line, bool resolved)
     : _id(id),
       _file(file),
       _line(line),
@@ -61,42 +62,89 @@ void Breakpoint::setEnabled(bool e)
   return _impl->breakpoint.SetEnabled(e);
   }
 
-size_t Breakpoint::locationCount() const
+Eks::String Breakpoint::condition() const
   {
-  return _impl->breakpoint.GetNumLocations() + _impl->breakpoint.GetNumResolvedLocations();
+  auto condition = _impl->breakpoint.GetCondition();
+  if (!condition)
+    {
+    return Eks::String();
+    }
+  return condition;
   }
 
-BreakpointLocation Breakpoint::locationAt(size_t i) const
+void Breakpoint::setCondition(const char *condition)
   {
-  auto loc = _impl->breakpoint.GetLocationAtIndex(i);
+  _impl->breakpoint.SetCondition(condition && *condition ? condition : nullptr);
+  }
 
-  auto lineSpec = loc.GetAddress().GetLineEntry();
-  auto fileSpec = loc.GetAddress().GetLineEntry().GetFileSpec();
-  auto line = lineSpec.GetLine();
+size_t Breakpoint::ignoreCount() const
+  {
+  return _impl->breakpoint.GetIgnoreCount();
+  }
 
-  lldb::SBAddress addr = loc.GetAddress();
-  lldb::SBSymbolContext ctx = addr.GetSymbolContext(lldb::eSymbolContextEverything);
+void Breakpoint::setIgnoreCount(size_t count)
+  {
+  _impl->breakpoint.SetIgnoreCount((uint32_t)count);
+  }
+
+size_t Breakpoint::hitCount() const
+  {
+  return _impl->breakpoint.GetHitCount();
+  }
 
-  lldb::SBAddress parentAddr;
-  if (ctx.GetParentOfInlinedScope(addr, parentAddr).IsValid())
+Eks::String Breakpoint::logMessage() const
+  {
+  if (!_impl->target)
+    {
+    return Eks::String();
+    }
+
+  return _impl->target->_impl->logMessage(_impl->breakpoint.GetID());
+  }
+
+void Breakpoint::setLogMessage(const char *message)
+  {
+  if (!_impl->target)
+    {
+    return;
+    }
+
+  _impl->target->_impl->setLogMessage(_impl->breakpoint, message);
+  }
+
+size_t Breakpoint::locationCount() const
+  {
+  return _impl->resolvedLocations().size();
+  }
+
+BreakpointLocation Breakpoint::locationAt(size_t i) const
+  {
+  const auto &locations = _impl->resolvedLocations();
+  if (i >= locations.size())
     {
-    auto blk = ctx.GetBlock();
-    lldb::SBBlock parentBlock = ctx.GetBlock().GetContainingInlinedBlock();
-    fileSpec = parentBlock.GetInlinedCallSiteFile();
-    line = parentBlock.GetInlinedCallSiteLine();
+    return BreakpointLocation();
     }
 
-  return BreakpointLocation{ loc.GetID(), fileSpecAsString(fileSpec).data(), line, loc.IsResolved() };
+  return locations[i];
   }
 
 bool Breakpoint::findLocation(const Eks::String &file, size_t line, BreakpointLocation *outLoc)
   {
-  auto locCount = locationCount();
-  for (size_t j = 0; j < locCount; ++j)
+  const auto &locations = _impl->resolvedLocations();
+  if (!_impl->target)
+    {
+    return false;
+    }
+
+  auto interned = _impl->target->_impl->findFile(file);
+  if (!interned)
     {
-    auto loc = locationAt(j);
+    return false;
+    }
 
-    if (loc.file() == file && loc.line() == line)
+  xForeach(const auto &loc, locations)
+    {
+    if (loc.internedFile().get() == interned && loc.line() == line)
       {
       *outLoc = loc;
       return true;
@@ -106,4 +154,54 @@ bool Breakpoint::findLocation(const Eks::String &file, size_t line, BreakpointLo
   return false;
   }
 
+const std::vector<BreakpointLocation> &Breakpoint::Impl::resolvedLocations()
+  {
+  if (target)
+    {
+    target->_impl->syncBreakpoints();
+    }
+
+  if (!locations)
+    {
+    locations = std::make_shared<Locations>();
+    }
+
+  if (locations->resolved)
+    {
+    return locations->locations;
+    }
+
+  locations->resolved = true;
+  locations->locations.clear();
+
+  auto count = breakpoint.GetNumLocations();
+  for (size_t i = 0; i < count; ++i)
+    {
+    auto loc = breakpoint.GetLocationAtIndex(i);
+
+    lldb::SBAddress addr = loc.GetAddress();
+    auto lineSpec = addr.GetLineEntry();
+    auto fileSpec = lineSpec.GetFileSpec();
+    auto line = lineSpec.GetLine();
+
+    lldb::SBSymbolContext ctx = addr.GetSymbolContext(lldb::eSymbolContextEverything);
+
+    lldb::SBAddress parentAddr;
+    if (ctx.GetParentOfInlinedScope(addr, parentAddr).IsValid())
+      {
+      lldb::SBBlock parentBlock = ctx.GetBlock().GetContainingInlinedBlock();
+      fileSpec = parentBlock.GetInlinedCallSiteFile();
+      line = parentBlock.GetInlinedCallSiteLine();
+      }
+
+    auto file = target ?
+      target->_impl->internFile(fileSpec) :
+      std::make_shared<const Eks::String>(fileSpecAsString(fileSpec));
+
+    locations->locations.push_back(BreakpointLocation{ loc.GetID(), file, line, loc.IsResolved() });
+    }
+
+  return locations->locations;
+  }
+
 }
@@ -0,0 +1,551 @@
+#include "ContiguousArray.h"
+#include "lldb/API/SBError.h"
+#include "lldb/API/SBTarget.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# include <emmintrin.h>
+# define LLDBDRIVER_SSE2
+#endif
+
+namespace LldbDriver
+{
+
+namespace
+{
+
+// True if [name] is the template [templateName], with any namespace (std::__1::vector, std::vector).
+bool isTemplate(const char *name, const char *space, const char *templateName)
+  {
+  if (!name)
+    {
+    return false;
+    }
+
+  // Types nested in a template (std::vector<int>::iterator) aren't the template itself.
+  const char *open = strchr(name, '<');
+  if (!open || name[strlen(name) - 1] != '>')
+    {
+    return false;
+    }
+
+  size_t spaceLength = strlen(space);
+  size_t nameLength = strlen(templateName);
+  size_t length = open - name;
+  if (length < nameLength || strncmp(open - nameLength, templateName, nameLength) != 0)
+    {
+    return false;
+    }
+
+  if (length == nameLength)
+    {
+    return spaceLength == 0;
+    }
+
+  return spaceLength && strncmp(name, space, spaceLength) == 0 && open[-(int)nameLength - 1] == ':';
+  }
+
+struct Accumulator
+  {
+  size_t count = 0;
+  double minimum = std::numeric_limits<double>::infinity();
+  double maximum = -std::numeric_limits<double>::infinity();
+  double sum = 0.0;
+  };
+
+template <typename T> void accumulate(const uint8_t *bytes, size_t count, Accumulator &acc)
+  {
+  const T *data = reinterpret_cast<const T *>(bytes);
+  if (count == 0)
+    {
+    return;
+    }
+
+  // Separate passes keep each loop simple enough for the compiler to vectorise.
+  T minimum = data[0];
+  T maximum = data[0];
+  for (size_t i = 1; i < count; ++i)
+    {
+    minimum = data[i] < minimum ? data[i] : minimum;
+    maximum = data[i] > maximum ? data[i] : maximum;
+    }
+
+  double sum = 0.0;
+  for (size_t i = 0; i < count; ++i)
+    {
+    sum += (double)data[i];
+    }
+
+  acc.count += count;
+  acc.minimum = std::min(acc.minimum, (double)minimum);
+  acc.maximum = std::max(acc.maximum, (double)maximum);
+  acc.sum += sum;
+  }
+
+#ifdef LLDBDRIVER_SSE2
+
+// NaNs are skipped by min and max, as the element is the first operand, but make the sum NaN.
+template <> void accumulate<float>(const uint8_t *bytes, size_t count, Accumulator &acc)
+  {
+  const float *data = reinterpret_cast<const float *>(bytes);
+
+  __m128 minimum = _mm_set1_ps(std::numeric_limits<float>::infinity());
+  __m128 maximum = _mm_set1_ps(-std::numeric_limits<float>::infinity());
+  // Floats are summed as doubles, a million of them would lose too much precision otherwise.
+  __m128d sumLow = _mm_setzero_pd();
+  __m128d sumHigh = _mm_setzero_pd();
+
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+    {
+    __m128 v = _mm_loadu_ps(data + i);
+    minimum = _mm_min_ps(v, minimum);
+    maximum = _mm_max_ps(v, maximum);
+    sumLow = _mm_add_pd(sumLow, _mm_cvtps_pd(v));
+    sumHigh = _mm_add_pd(sumHigh, _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+    }
+
+  float minimums[4];
+  float maximums[4];
+  double sums[2];
+  _mm_storeu_ps(minimums, minimum);
+  _mm_storeu_ps(maximums, maximum);
+  _mm_storeu_pd(sums, _mm_add_pd(sumLow, sumHigh));
+
+  double sum = sums[0] + sums[1];
+  for (int j = 0; j < 4; ++j)
+    {
+    acc.minimum = minimums[j] < acc.minimum ? minimums[j] : acc.minimum;
+    acc.maximum = maximums[j] > acc.maximum ? maximums[j] : acc.maximum;
+    }
+
+  for (; i < count; ++i)
+    {
+    acc.minimum = data[i] < acc.minimum ? data[i] : acc.minimum;
+    acc.maximum = data[i] > acc.maximum ? data[i] : acc.maximum;
+    sum += data[i];
+    }
+
+  acc.count += count;
+  acc.sum += sum;
+  }
+
+template <> void accumulate<double>(const uint8_t *bytes, size_t count, Accumulator &acc)
+  {
+  const double *data = reinterpret_cast<const double *>(bytes);
+
+  __m128d minimum = _mm_set1_pd(std::numeric_limits<double>::infinity());
+  __m128d maximum = _mm_set1_pd(-std::numeric_limits<double>::infinity());
+  __m128d sum = _mm_setzero_pd();
+
+  size_t i = 0;
+  for (; i + 2 <= count; i += 2)
+    {
+    __m128d v = _mm_loadu_pd(data + i);
+    minimum = _mm_min_pd(v, minimum);
+    maximum = _mm_max_pd(v, maximum);
+    sum = _mm_add_pd(sum, v);
+    }
+
+  double minimums[2];
+  double maximums[2];
+  double sums[2];
+  _mm_storeu_pd(minimums, minimum);
+  _mm_storeu_pd(maximums, maximum);
+  _mm_storeu_pd(sums, sum);
+
+  double total = sums[0] + sums[1];
+  for (int j = 0; j < 2; ++j)
+    {
+    acc.minimum = minimums[j] < acc.minimum ? minimums[j] : acc.minimum;
+    acc.maximum = maximums[j] > acc.maximum ? maximums[j] : acc.maximum;
+    }
+
+  for (; i < count; ++i)
+    {
+    acc.minimum = data[i] < acc.minimum ? data[i] : acc.minimum;
+    acc.maximum = data[i] > acc.maximum ? data[i] : acc.maximum;
+    total += data[i];
+    }
+
+  acc.count += count;
+  acc.sum += total;
+  }
+
+#endif
+
+template <typename T> T load(const uint8_t *data)
+  {
+  T value;
+  memcpy(&value, data, sizeof(T));
+  return value;
+  }
+
+}
+
+ContiguousArray::ContiguousArray()
+    : _layout(None),
+      _element(Unknown),
+      _character(false),
+      _elementSize(0),
+      _pointerCount(0)
+  {
+  }
+
+void ContiguousArray::detect(lldb::SBValue value)
+  {
+  _layout = None;
+
+  auto type = value.GetType().GetCanonicalType();
+  if (type.IsReferenceType())
+    {
+    type = type.GetDereferencedType().GetCanonicalType();
+    }
+
+  const char *name = type.GetName();
+  if (type.IsArrayType())
+    {
+    if (setElementType(type.GetArrayElementType()))
+      {
+      _layout = Array;
+      }
+    }
+  else if (isTemplate(name, "std::", "array"))
+    {
+    // Just a C array member, laid out from the start of the value.
+    if (setElementType(type.GetTemplateArgumentType(0)))
+      {
+      _layout = Array;
+      }
+    }
+  else if (isTemplate(name, "std::", "vector"))
+    {
+    // vector<bool> packs its elements into bits.
+    if (setElementType(type.GetTemplateArgumentType(0)) && _element != Bool)
+      {
+      _layout = Vector;
+      }
+    }
+  else if (isTemplate(name, "", "QVector"))
+    {
+    if (setElementType(type.GetTemplateArgumentType(0)))
+      {
+      _layout = QtVector;
+      }
+    }
+  }
+
+void ContiguousArray::setPointer(lldb::SBValue value, size_t count)
+  {
+  _layout = None;
+
+  auto type = value.GetType().GetCanonicalType();
+  if (type.IsPointerType() && setElementType(type.GetPointeeType()))
+    {
+    _layout = Pointer;
+    _pointerCount = count;
+    }
+  }
+
+bool ContiguousArray::setElementType(lldb::SBType type)
+  {
+  if (!type.IsValid())
+    {
+    return false;
+    }
+
+  _elementType = type;
+  _elementSize = (size_t)type.GetByteSize();
+  _character = false;
+  _element = Unknown;
+
+  auto canonical = type.GetCanonicalType();
+  bool isSigned = (canonical.GetTypeFlags() & lldb::eTypeIsSigned) != 0;
+  switch (canonical.GetBasicType())
+    {
+  case lldb::eBasicTypeBool:
+    _element = Bool;
+    break;
+  case lldb::eBasicTypeFloat:
+    _element = Float;
+    break;
+  case lldb::eBasicTypeDouble:
+    _element = Double;
+    break;
+  case lldb::eBasicTypeChar:
+  case lldb::eBasicTypeSignedChar:
+  case lldb::eBasicTypeUnsignedChar:
+    _character = true;
+    _element = isSigned ? Int8 : UInt8;
+    break;
+  case lldb::eBasicTypeShort:
+  case lldb::eBasicTypeUnsignedShort:
+  case lldb::eBasicTypeInt:
+  case lldb::eBasicTypeUnsignedInt:
+  case lldb::eBasicTypeLong:
+  case lldb::eBasicTypeUnsignedLong:
+  case lldb::eBasicTypeLongLong:
+  case lldb::eBasicTypeUnsignedLongLong:
+  case lldb::eBasicTypeWChar:
+  case lldb::eBasicTypeSignedWChar:
+  case lldb::eBasicTypeUnsignedWChar:
+  case lldb::eBasicTypeChar16:
+  case lldb::eBasicTypeChar32:
+    switch (_elementSize)
+      {
+    case 1:
+      _element = isSigned ? Int8 : UInt8;
+      break;
+    case 2:
+      _element = isSigned ? Int16 : UInt16;
+      break;
+    case 4:
+      _element = isSigned ? Int32 : UInt32;
+      break;
+    case 8:
+      _element = isSigned ? Int64 : UInt64;
+      break;
+      }
+    break;
+  default:
+    break;
+    }
+
+  return _element != Unknown && _elementSize != 0;
+  }
+
+bool ContiguousArray::locate(lldb::SBValue value, uint64_t &address, size_t &count) const
+  {
+  if (value.GetType().IsReferenceType())
+    {
+    value = value.Dereference();
+    }
+
+  address = LLDB_INVALID_ADDRESS;
+  count = 0;
+  switch (_layout)
+    {
+  case None:
+    return false;
+  case Array:
+    address = value.GetLoadAddress();
+    count = (size_t)value.GetByteSize() / _elementSize;
+    break;
+  case Pointer:
+    address = value.GetValueAsUnsigned(LLDB_INVALID_ADDRESS);
+    count = _pointerCount;
+    break;
+  case Vector:
+    {
+    // libc++ and libstdc++ both keep a pointer to the first and one past the last element.
+    auto begin = value.GetChildMemberWithName("__begin_");
+    auto end = value.GetChildMemberWithName("__end_");
+    if (!begin.IsValid())
+      {
+      auto impl = value.GetChildMemberWithName("_M_impl");
+      begin = impl.GetChildMemberWithName("_M_start");
+      end = impl.GetChildMemberWithName("_M_finish");
+      }
+
+    uint64_t first = begin.GetValueAsUnsigned(0);
+    uint64_t last = end.GetValueAsUnsigned(0);
+    if (!begin.IsValid() || !end.IsValid() || last < first)
+      {
+      return false;
+      }
+
+    address = first;
+    count = (size_t)((last - first) / _elementSize);
+    break;
+    }
+  case QtVector:
+    {
+    // QArrayData starts with the reference count and size as ints, then the capacity,
+    // then the offset from the header to the elements, pointer aligned.
+    uint64_t header = value.GetChildMemberWithName("d").GetValueAsUnsigned(0);
+    if (!header)
+      {
+      return false;
+      }
+
+    auto process = value.GetProcess();
+    size_t pointerSize = process.GetAddressByteSize();
+
+    lldb::SBError error;
+    int32_t size = 0;
+    int64_t offset = 0;
+    if (process.ReadMemory(header + 4, &size, sizeof(size), error) != sizeof(size) ||
+        process.ReadMemory(header + 12 + (pointerSize == 8 ? 4 : 0), &offset, pointerSize, error) != pointerSize ||
+        size < 0)
+      {
+      return false;
+      }
+
+    if (pointerSize == 4)
+      {
+      offset = (int32_t)offset;
+      }
+
+    address = header + offset;
+    count = (size_t)size;
+    break;
+    }
+    }
+
+  return address != LLDB_INVALID_ADDRESS && count <= MaxElements;
+  }
+
+size_t ContiguousArray::read(lldb::SBValue value, size_t start, size_t count, std::vector<uint8_t> &bytes) const
+  {
+  uint64_t address = 0;
+  size_t total = 0;
+  if (!locate(value, address, total) || start >= total)
+    {
+    bytes.clear();
+    return 0;
+    }
+
+  count = std::min(count, total - start);
+  bytes.resize(count * _elementSize);
+
+  lldb::SBError error;
+  size_t read = value.GetProcess().ReadMemory(address + start * _elementSize, bytes.data(), bytes.size(), error);
+  return read / _elementSize;
+  }
+
+Eks::String ContiguousArray::format(const uint8_t *data) const
+  {
+  char buffer[64];
+  switch (_element)
+    {
+  case Unknown:
+    return Eks::String();
+  case Bool:
+    return data[0] ? "true" : "false";
+  case Int8:
+  case UInt8:
+    {
+    int v = _element == Int8 ? (int)load<int8_t>(data) : (int)load<uint8_t>(data);
+    if (_character && v >= 0x20 && v < 0x7f)
+      {
+      snprintf(buffer, sizeof(buffer), "%d '%c'", v, (char)v);
+      }
+    else
+      {
+      snprintf(buffer, sizeof(buffer), "%d", v);
+      }
+    break;
+    }
+  case Int16:
+    snprintf(buffer, sizeof(buffer), "%d", (int)load<int16_t>(data));
+    break;
+  case UInt16:
+    snprintf(buffer, sizeof(buffer), "%u", (unsigned)load<uint16_t>(data));
+    break;
+  case Int32:
+    snprintf(buffer, sizeof(buffer), "%d", (int)load<int32_t>(data));
+    break;
+  case UInt32:
+    snprintf(buffer, sizeof(buffer), "%u", (unsigned)load<uint32_t>(data));
+    break;
+  case Int64:
+    snprintf(buffer, sizeof(buffer), "%lld", (long long)load<int64_t>(data));
+    break;
+  case UInt64:
+    snprintf(buffer, sizeof(buffer), "%llu", (unsigned long long)load<uint64_t>(data));
+    break;
+  case Float:
+    // Enough digits to round trip, as lldb shows them.
+    snprintf(buffer, sizeof(buffer), "%.9g", (double)load<float>(data));
+    break;
+  case Double:
+    snprintf(buffer, sizeof(buffer), "%.17g", load<double>(data));
+    break;
+    }
+
+  return buffer;
+  }
+
+ArrayStatistics ContiguousArray::statistics(lldb::SBValue value) const
+  {
+  ArrayStatistics result;
+
+  uint64_t address = 0;
+  size_t count = 0;
+  if (_element == Unknown || !locate(value, address, count))
+    {
+    return result;
+    }
+
+  auto process = value.GetProcess();
+  const size_t chunkElements = std::max<size_t>(ChunkBytes / _elementSize, 1);
+
+  Accumulator acc;
+  std::vector<uint8_t> bytes;
+  for (size_t start = 0; start < count; start += chunkElements)
+    {
+    size_t chunk = std::min(chunkElements, count - start);
+    bytes.resize(chunk * _elementSize);
+
+    lldb::SBError error;
+    size_t read = process.ReadMemory(address + start * _elementSize, bytes.data(), bytes.size(), error) / _elementSize;
+
+    switch (_element)
+      {
+    case Unknown:
+      break;
+    case Bool:
+    case UInt8:
+      accumulate<uint8_t>(bytes.data(), read, acc);
+      break;
+    case Int8:
+      accumulate<int8_t>(bytes.data(), read, acc);
+      break;
+    case Int16:
+      accumulate<int16_t>(bytes.data(), read, acc);
+      break;
+    case UInt16:
+      accumulate<uint16_t>(bytes.data(), read, acc);
+      break;
+    case Int32:
+      accumulate<int32_t>(bytes.data(), read, acc);
+      break;
+    case UInt32:
+      accumulate<uint32_t>(bytes.data(), read, acc);
+      break;
+    case Int64:
+      accumulate<int64_t>(bytes.data(), read, acc);
+      break;
+    case UInt64:
+      accumulate<uint64_t>(bytes.data(), read, acc);
+      break;
+    case Float:
+      accumulate<float>(bytes.data(), read, acc);
+      break;
+    case Double:
+      accumulate<double>(bytes.data(), read, acc);
+      break;
+      }
+
+    if (read < chunk)
+      {
+      return result;
+      }
+    }
+
+  result._valid = true;
+  result._count = acc.count;
+  result._sum = acc.sum;
+  if (acc.count)
+    {
+    result._minimum = acc.minimum;
+    result._maximum = acc.maximum;
+    }
+
+  return result;
+  }
+
+}
@@ -0,0 +1,286 @@
+#include "Evaluator.h"
+#include "EvaluatorImpl.h"
+#include "FrameImpl.h"
+#include "Value.h"
+#include "ValueImpl.h"
+#include "lldb/API/SBAddress.h"
+#include "lldb/API/SBBlock.h"
+#include "lldb/API/SBError.h"
+#include "lldb/API/SBProcess.h"
+#include "lldb/API/SBThread.h"
+#include <cctype>
+
+namespace LldbDriver
+{
+
+namespace
+{
+
+bool isIdentifierStart(char c)
+  {
+  return std::isalpha((unsigned char)c) || c == '_';
+  }
+
+bool isIdentifier(char c)
+  {
+  return std::isalnum((unsigned char)c) || c == '_';
+  }
+
+}
+
+Evaluation::Evaluation()
+    : _method(EvaluationMethod::None)
+  {
+  }
+
+Evaluator::Evaluator()
+  {
+  }
+
+Evaluator::~Evaluator()
+  {
+  }
+
+Evaluator::Pointer Evaluator::create()
+  {
+  return std::make_shared<Evaluator>();
+  }
+
+EvaluationPolicy Evaluator::policy() const
+  {
+  std::lock_guard<std::mutex> l(_impl->lock);
+  return _impl->policy;
+  }
+
+void Evaluator::setPolicy(EvaluationPolicy policy)
+  {
+  std::lock_guard<std::mutex> l(_impl->lock);
+  if (policy != _impl->policy)
+    {
+    _impl->policy = policy;
+    // Failures under the old policy might succeed now, and the other way around.
+    _impl->entries.clear();
+    }
+  }
+
+size_t Evaluator::timeout() const
+  {
+  std::lock_guard<std::mutex> l(_impl->lock);
+  return _impl->timeout;
+  }
+
+void Evaluator::setTimeout(size_t microseconds)
+  {
+  std::lock_guard<std::mutex> l(_impl->lock);
+  _impl->timeout = microseconds;
+  }
+
+Evaluation Evaluator::evaluate(const Frame &frame, const char *expression)
+  {
+  std::lock_guard<std::mutex> l(_impl->lock);
+  Evaluation evaluation;
+
+  auto &f = frame._impl->frame;
+  if (!expression || !*expression || !f.IsValid())
+    {
+    evaluation._method = EvaluationMethod::Failed;
+    evaluation._error = "No frame or expression to evaluate";
+    return evaluation;
+    }
+
+  const char *function = f.GetFunctionName();
+  std::string key = function ? function : "";
+  key.push_back('\0');
+  key.append(expression);
+
+  if (_impl->entries.size() >= Impl::MaxEntries && !_impl->entries.count(key))
+    {
+    _impl->entries.clear();
+    }
+
+  auto &entry = _impl->entries[key];
+  auto cfa = f.GetCFA();
+  auto pc = f.GetPC();
+  auto block = Impl::blockStart(f);
+  auto stopId = f.GetThread().GetProcess().GetStopID();
+  bool variablePath = Impl::isVariablePath(expression);
+
+  switch (entry.method)
+    {
+  case EvaluationMethod::Failed:
+    // What compiles depends on what is in scope, and a block's locals are only in scope inside it,
+    // so a failure is only certain at the same pc. Variable paths are cheap enough to always try again.
+    if (!variablePath && entry.pc == pc)
+      {
+      evaluation._method = EvaluationMethod::Failed;
+      evaluation._error = entry.error.c_str();
+      return evaluation;
+      }
+    break;
+
+  case EvaluationMethod::VariablePath:
+    // The value is tied to its frame, and lldb re-reads it at each stop. A name can mean a different
+    // variable in another block of the same frame, so the block has to match too.
+    if (entry.cfa == cfa && entry.block == block)
+      {
+      evaluation._method = entry.stopId == stopId ? EvaluationMethod::Cached : EvaluationMethod::VariablePath;
+      evaluation._value = Value::Impl::make(entry.result);
+      entry.stopId = stopId;
+      entry.pc = pc;
+      return evaluation;
+      }
+    break;
+
+  case EvaluationMethod::Expression:
+    if (entry.cfa == cfa && entry.stopId == stopId)
+      {
+      evaluation._method = EvaluationMethod::Cached;
+      evaluation._value = Value::Impl::make(entry.result);
+      return evaluation;
+      }
+    break;
+
+  default:
+    break;
+    }
+
+  entry.cfa = cfa;
+  entry.stopId = stopId;
+  entry.pc = pc;
+  entry.block = block;
+
+  std::string pathError = "Not a variable path, and evaluating it could run the target";
+  if (variablePath)
+    {
+    auto result = f.GetValueForVariablePath(expression, lldb::eNoDynamicValues);
+    const char *message = result.GetError().GetCString();
+    pathError = message ? message : "No variable found for the path";
+    if (result.IsValid() && result.GetError().Success())
+      {
+      entry.method = EvaluationMethod::VariablePath;
+      entry.result = result;
+      evaluation._method = EvaluationMethod::VariablePath;
+      evaluation._value = Value::Impl::make(result);
+      return evaluation;
+      }
+    }
+
+  if (_impl->policy == EvaluationPolicy::VariablesOnly)
+    {
+    // Not remembered, a variable that isn't in scope yet may be by the next stop.
+    evaluation._method = EvaluationMethod::Failed;
+    evaluation._error = pathError.c_str();
+    _impl->entries.erase(key);
+    return evaluation;
+    }
+
+  auto result = f.EvaluateExpression(expression, Impl::options(_impl->timeout));
+  auto error = result.GetError();
+  if (error.Fail())
+    {
+    const char *message = error.GetCString();
+
+    // Only remember compile errors, running it might work next time.
+    bool parseError = error.GetType() == lldb::eErrorTypeExpression && error.GetError() == lldb::eExpressionParseError;
+    entry.method = parseError ? EvaluationMethod::Failed : EvaluationMethod::None;
+    entry.error = message ? message : "Evaluation failed";
+    entry.result = lldb::SBValue();
+
+    evaluation._method = EvaluationMethod::Failed;
+    evaluation._error = entry.error.c_str();
+    return evaluation;
+    }
+
+  entry.method = EvaluationMethod::Expression;
+  entry.result = result;
+  evaluation._method = EvaluationMethod::Expression;
+  evaluation._value = Value::Impl::make(result);
+  return evaluation;
+  }
+
+size_t Evaluator::cacheSize() const
+  {
+  std::lock_guard<std::mutex> l(_impl->lock);
+  return _impl->entries.size();
+  }
+
+void Evaluator::clear()
+  {
+  std::lock_guard<std::mutex> l(_impl->lock);
+  _impl->entries.clear();
+  }
+
+lldb::addr_t Evaluator::Impl::blockStart(const lldb::SBFrame &frame)
+  {
+  auto block = frame.GetBlock();
+  if (!block.IsValid() || !block.GetNumRanges())
+    {
+    return LLDB_INVALID_ADDRESS;
+    }
+
+  return block.GetRangeStartAddress(0).GetFileAddress();
+  }
+
+bool Evaluator::Impl::isVariablePath(const char *expression)
+  {
+  // Things "frame variable" understands: an optional * or &, a name, then members and constant indices.
+  const char *c = expression;
+  if (*c == '*' || *c == '&')
+    {
+    ++c;
+    }
+
+  if (!isIdentifierStart(*c))
+    {
+    return false;
+    }
+
+  while (isIdentifier(*c))
+    {
+    ++c;
+    }
+
+  while (*c)
+    {
+    if (*c == '.' || (c[0] == '-' && c[1] == '>'))
+      {
+      c += *c == '.' ? 1 : 2;
+      if (!isIdentifierStart(*c))
+        {
+        return false;
+        }
+
+      while (isIdentifier(*c))
+        {
+        ++c;
+        }
+      }
+    else if (*c == '[')
+      {
+      ++c;
+      if (!std::isdigit((unsigned char)*c))
+        {
+        return false;
+        }
+
+      while (std::isdigit((unsigned char)*c))
+        {
+        ++c;
+        }
+
+      if (*c != ']')
+        {
+        return false;
+        }
+      ++c;
+      }
+    else
+      {
+      return false;
+      }
+    }
+
+  return true;
+  }
+
+}
@@ -2,6 +2,7 @@
 #include "FrameImpl.h"
 #include "Value.h"
 #include "ValueImpl.h"
+#include "EvaluatorImpl.h"
 #include "Math/XMathHelpers.h"
 #include "Containers/XStringSimple.h"
 #include "Containers/XStringBuilder.h"
@@ -103,6 +104,7 @@ Eks::Vector<Value> Frame::locals() const
 
 Value Frame::evaluate(const char *e) const
   {
-  return Value::Impl::make(_impl->frame.EvaluateExpression(e, lldb::eNoDynamicValues, true));
+  auto options = Evaluator::Impl::options(Evaluator::Impl::DefaultTimeout);
+  return Value::Impl::make(_impl->frame.EvaluateExpression(e, options));
   }
 }
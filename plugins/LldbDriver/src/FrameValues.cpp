@@ -0,0 +1,203 @@
+#include "FrameValues.h"
+#include "FrameValuesImpl.h"
+#include "FrameImpl.h"
+#include "Value.h"
+#include "ValueImpl.h"
+#include "lldb/API/SBData.h"
+#include "lldb/API/SBError.h"
+#include "lldb/API/SBThread.h"
+#include <algorithm>
+#include <cstring>
+
+namespace LldbDriver
+{
+
+namespace
+{
+
+// Frames are small, if the variables are spread further apart than this they are read one at a time.
+const lldb::addr_t maxBlockSize = 64 * 1024;
+
+}
+
+FrameValues::FrameValues()
+  {
+  }
+
+FrameValues::~FrameValues()
+  {
+  }
+
+FrameValues::Pointer FrameValues::create()
+  {
+  return std::make_shared<FrameValues>();
+  }
+
+bool FrameValues::update(const Frame &frame)
+  {
+  auto &f = frame._impl->frame;
+  auto cfa = f.GetCFA();
+  const char *function = f.GetFunctionName();
+  if (!function)
+    {
+    function = "";
+    }
+
+  auto process = f.GetThread().GetProcess();
+  if (_impl->valid && _impl->cfa == cfa && _impl->function == function)
+    {
+    _impl->read(process);
+    return true;
+    }
+
+  _impl->entries.clear();
+  _impl->add(f.GetVariables(true, false, false, false, lldb::eDynamicDontRunTarget), true);
+  _impl->add(f.GetVariables(false, true, false, false, lldb::eDynamicDontRunTarget), false);
+  _impl->read(process);
+
+  // Everything is new, there is nothing to have changed from.
+  _impl->changed.clear();
+  _impl->valid = f.IsValid() && cfa != LLDB_INVALID_ADDRESS;
+  _impl->cfa = cfa;
+  _impl->function = function;
+  return false;
+  }
+
+void FrameValues::clear()
+  {
+  _impl->valid = false;
+  _impl->entries.clear();
+  _impl->changed.clear();
+  }
+
+size_t FrameValues::count() const
+  {
+  return _impl->entries.size();
+  }
+
+Value FrameValues::valueAt(size_t i) const
+  {
+  if (i >= _impl->entries.size())
+    {
+    return Value();
+    }
+
+  return Value::Impl::make(_impl->entries[i].value);
+  }
+
+bool FrameValues::isArgument(size_t i) const
+  {
+  return i < _impl->entries.size() && _impl->entries[i].argument;
+  }
+
+Eks::Vector<size_t> FrameValues::changed() const
+  {
+  Eks::Vector<size_t> result(Eks::Core::defaultAllocator());
+  result.resize(_impl->changed.size());
+
+  for (size_t i = 0; i < _impl->changed.size(); ++i)
+    {
+    result[i] = _impl->changed[i];
+    }
+
+  return result;
+  }
+
+void FrameValues::Impl::add(const lldb::SBValueList &values, bool argument)
+  {
+  for (uint32_t i = 0; i < values.GetSize(); ++i)
+    {
+    Entry entry;
+    entry.value = values.GetValueAtIndex(i).GetNonSyntheticValue();
+    entry.argument = argument;
+    entry.address = LLDB_INVALID_ADDRESS;
+    entry.size = 0;
+    entries.push_back(std::move(entry));
+    }
+  }
+
+void FrameValues::Impl::read(lldb::SBProcess process)
+  {
+  changed.clear();
+
+  // Locations can move between registers and the stack as the pc does, so find them again each time.
+  lldb::addr_t low = LLDB_INVALID_ADDRESS;
+  lldb::addr_t high = 0;
+  xForeach(auto &entry, entries)
+    {
+    entry.address = entry.value.GetLoadAddress();
+    entry.size = (size_t)entry.value.GetByteSize();
+    if (entry.address != LLDB_INVALID_ADDRESS && entry.size)
+      {
+      low = std::min(low, entry.address);
+      high = std::max(high, entry.address + entry.size);
+      }
+    }
+
+  bool haveBlock = false;
+  if (low != LLDB_INVALID_ADDRESS && high - low <= maxBlockSize)
+    {
+    lldb::SBError error;
+    block.resize((size_t)(high - low));
+    haveBlock = process.ReadMemory(low, block.data(), block.size(), error) == block.size();
+    }
+
+  for (size_t i = 0; i < entries.size(); ++i)
+    {
+    auto &entry = entries[i];
+
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    if (entry.address != LLDB_INVALID_ADDRESS && haveBlock)
+      {
+      data = block.data() + (entry.address - low);
+      size = entry.size;
+      }
+    else if (entry.address != LLDB_INVALID_ADDRESS)
+      {
+      lldb::SBError error;
+      scratch.resize(entry.size);
+      size = process.ReadMemory(entry.address, scratch.data(), scratch.size(), error);
+      data = scratch.data();
+      }
+    else
+      {
+      readData(entry, scratch);
+      data = scratch.data();
+      size = scratch.size();
+      }
+
+    // A char * or a std::string can change while its own bytes don't, so compare what is shown for it too.
+    const char *summary = entry.value.GetSummary();
+    if (!summary)
+      {
+      summary = "";
+      }
+
+    if (size == entry.bytes.size() && (size == 0 || memcmp(data, entry.bytes.data(), size) == 0) &&
+        entry.summary == summary)
+      {
+      continue;
+      }
+
+    entry.bytes.assign(data, data + size);
+    entry.summary = summary;
+    changed.push_back(i);
+    }
+  }
+
+void FrameValues::Impl::readData(Entry &entry, std::vector<uint8_t> &bytes)
+  {
+  auto data = entry.value.GetData();
+  bytes.resize(data.GetByteSize());
+  if (bytes.empty())
+    {
+    return;
+    }
+
+  lldb::SBError error;
+  auto read = data.ReadRawData(error, 0, bytes.data(), bytes.size());
+  bytes.resize(error.Success() ? read : 0);
+  }
+
+}
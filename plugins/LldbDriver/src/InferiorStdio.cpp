@@ -0,0 +1,375 @@
+#include "InferiorStdio.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/stat.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace LldbDriver
+{
+
+namespace
+{
+
+const size_t readSize = 64 * 1024;
+// Output left waiting for the consumer before the reader stops taking more from the inferior.
+const size_t maxWaitingSize = 4 * 1024 * 1024;
+// How often the reader wakes to check it should stop.
+const int pollTimeoutMs = 250;
+
+bool setNonBlocking(int fd)
+  {
+  int flags = fcntl(fd, F_GETFL);
+  return flags != -1 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) != -1;
+  }
+
+}
+
+InferiorStdio::InferiorStdio(StdioMode mode)
+    : _mode(mode),
+      _input(-1),
+      _quit(false)
+  {
+  }
+
+InferiorStdio::~InferiorStdio()
+  {
+  _quit = true;
+  if (_reader.joinable())
+    {
+    _reader.join();
+    }
+
+  for (int fd : { _input, _output.fd, _error.fd })
+    {
+    if (fd != -1)
+      {
+      close(fd);
+      }
+    }
+
+  xForeach(int fd, _keepOpen)
+    {
+    close(fd);
+    }
+
+  if (!_directory.empty())
+    {
+    unlink(_stdinPath.c_str());
+    unlink(_stdoutPath.c_str());
+    unlink(_stderrPath.c_str());
+    rmdir(_directory.c_str());
+    }
+  }
+
+std::unique_ptr<InferiorStdio> InferiorStdio::create(StdioMode mode, lldb::SBError &error)
+  {
+  std::unique_ptr<InferiorStdio> stdio(new InferiorStdio(mode));
+
+  bool created = false;
+  if (mode == StdioMode::Pipes)
+    {
+    created = stdio->createPipes(error);
+    }
+  else if (mode == StdioMode::Pty)
+    {
+    created = stdio->createPty(error);
+    }
+  else
+    {
+    error.SetErrorString("Standard streams proxied by lldb don't need creating");
+    }
+
+  if (!created)
+    {
+    return nullptr;
+    }
+
+  return stdio;
+  }
+
+bool InferiorStdio::createPipes(lldb::SBError &error)
+  {
+  // lldb launches with paths rather than descriptors, so the pipes are named.
+  const char *tmp = getenv("TMPDIR");
+  std::string directory = tmp && *tmp ? tmp : "/tmp";
+  if (directory.back() != '/')
+    {
+    directory += '/';
+    }
+  directory += "debugify.XXXXXX";
+
+  if (!mkdtemp(&directory[0]))
+    {
+    error.SetErrorToErrno();
+    return false;
+    }
+
+  _directory = directory;
+  _stdinPath = _directory + "/stdin";
+  _stdoutPath = _directory + "/stdout";
+  _stderrPath = _directory + "/stderr";
+
+  for (const auto &path : { _stdinPath, _stdoutPath, _stderrPath })
+    {
+    if (mkfifo(path.c_str(), 0600) != 0)
+      {
+      error.SetErrorToErrno();
+      return false;
+      }
+    }
+
+  // Opening read ends without blocking succeeds before there is a writer. A write end of
+  // our own keeps reads from seeing end of file until the inferior opens its end.
+  auto openOutput = [this](const std::string &path, Stream &stream)
+    {
+    stream.fd = open(path.c_str(), O_RDONLY | O_NONBLOCK);
+    int keep = stream.fd != -1 ? open(path.c_str(), O_WRONLY | O_NONBLOCK) : -1;
+    if (keep == -1)
+      {
+      return false;
+      }
+
+    _keepOpen.push_back(keep);
+    return true;
+    };
+
+  if (!openOutput(_stdoutPath, _output) || !openOutput(_stderrPath, _error))
+    {
+    error.SetErrorToErrno();
+    return false;
+    }
+
+  // Read and write, so opening doesn't wait for the inferior to open its end.
+  _input = open(_stdinPath.c_str(), O_RDWR | O_NONBLOCK);
+  if (_input == -1)
+    {
+    error.SetErrorToErrno();
+    return false;
+    }
+
+  return true;
+  }
+
+bool InferiorStdio::createPty(lldb::SBError &error)
+  {
+  int master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (master == -1 || grantpt(master) != 0 || unlockpt(master) != 0 || !setNonBlocking(master))
+    {
+    error.SetErrorToErrno();
+    if (master != -1)
+      {
+      close(master);
+      }
+    return false;
+    }
+
+  _output.fd = master;
+  _input = dup(master);
+
+  const char *name = ptsname(master);
+  if (!name || _input == -1)
+    {
+    error.SetErrorToErrno();
+    return false;
+    }
+
+  _stdinPath = _stdoutPath = _stderrPath = name;
+
+  // Holding the slave open stops reads failing before the inferior opens it.
+  int slave = open(name, O_RDWR | O_NOCTTY);
+  if (slave == -1)
+    {
+    error.SetErrorToErrno();
+    return false;
+    }
+  _keepOpen.push_back(slave);
+
+  // The console echoes input itself, and shows plain newlines.
+  termios settings;
+  if (tcgetattr(slave, &settings) == 0)
+    {
+    settings.c_lflag &= ~(ECHO | ECHONL);
+    settings.c_oflag &= ~ONLCR;
+    tcsetattr(slave, TCSANOW, &settings);
+    }
+
+  return true;
+  }
+
+void InferiorStdio::start(const Callback &cb)
+  {
+  _callback = cb;
+  _reader = std::thread([this]() { readLoop(); });
+  }
+
+size_t InferiorStdio::read(Process::OutputType type, char *data, size_t size)
+  {
+  std::lock_guard<std::mutex> l(_lock);
+  auto &buffer = stream(type).buffer;
+
+  size = std::min(size, buffer.size());
+  std::copy(buffer.begin(), buffer.begin() + size, data);
+  buffer.erase(buffer.begin(), buffer.begin() + size);
+  return size;
+  }
+
+size_t InferiorStdio::drain(Process::OutputType type, std::vector<char> &buffer)
+  {
+  std::lock_guard<std::mutex> l(_lock);
+  auto &waiting = stream(type).buffer;
+  size_t size = waiting.size();
+
+  if (buffer.empty())
+    {
+    // Hand over the storage that was read into, and take the consumer's in exchange to read into next.
+    buffer.swap(waiting);
+    }
+  else
+    {
+    buffer.insert(buffer.end(), waiting.begin(), waiting.end());
+    }
+
+  waiting.clear();
+  return size;
+  }
+
+size_t InferiorStdio::write(const char *data, size_t size)
+  {
+  size_t written = 0;
+  while (written < size)
+    {
+    auto result = ::write(_input, data + written, size - written);
+    if (result < 0)
+      {
+      if (errno == EINTR)
+        {
+        continue;
+        }
+      if (errno == EAGAIN)
+        {
+        // The inferior isn't reading, wait for room rather than dropping input.
+        pollfd fd = { _input, POLLOUT, 0 };
+        if (poll(&fd, 1, pollTimeoutMs) > 0)
+          {
+          continue;
+          }
+        }
+      break;
+      }
+
+    written += result;
+    }
+
+  return written;
+  }
+
+void InferiorStdio::readLoop()
+  {
+  Stream *streams[] = { &_output, &_error };
+  const Process::OutputType types[] = { Process::OutputType::Output, Process::OutputType::Error };
+
+  pollfd fds[2];
+  size_t polled[2];
+  nfds_t count = 0;
+  for (size_t s = 0; s < 2; ++s)
+    {
+    if (streams[s]->fd != -1)
+      {
+      polled[count] = s;
+      fds[count++] = pollfd{ streams[s]->fd, POLLIN, 0 };
+      }
+    }
+
+  while (!_quit && count)
+    {
+    // Streams the consumer has fallen behind on aren't read, so the inferior blocks on its
+    // writes rather than the waiting output growing without bound. A negative fd is skipped.
+    {
+    std::lock_guard<std::mutex> l(_lock);
+    for (nfds_t i = 0; i < count; ++i)
+      {
+      auto stream = streams[polled[i]];
+      fds[i].fd = stream->buffer.size() < maxWaitingSize ? stream->fd : -1;
+      }
+    }
+
+    int ready = poll(fds, count, pollTimeoutMs);
+    if (ready <= 0)
+      {
+      if (ready < 0 && errno != EINTR)
+        {
+        break;
+        }
+      continue;
+      }
+
+    for (nfds_t i = 0; i < count; ++i)
+      {
+      if (!(fds[i].revents & (POLLIN | POLLHUP)))
+        {
+        continue;
+        }
+
+      size_t s = polled[i];
+      if (readStream(*streams[s]) && _callback)
+        {
+        _callback(types[s]);
+        }
+      }
+    }
+  }
+
+bool InferiorStdio::readStream(Stream &stream)
+  {
+  size_t room = 0;
+  {
+  std::lock_guard<std::mutex> l(_lock);
+  room = maxWaitingSize - std::min(stream.buffer.size(), maxWaitingSize);
+  }
+
+  // Read without the lock, so drain isn't kept waiting behind the reads,
+  // until a short read shows the stream is empty.
+  auto &incoming = stream.incoming;
+  incoming.clear();
+  while (incoming.size() < room)
+    {
+    size_t size = incoming.size();
+    size_t wanted = std::min(readSize, room - size);
+    incoming.resize(size + wanted);
+    auto result = ::read(stream.fd, incoming.data() + size, wanted);
+    incoming.resize(size + std::max<ssize_t>(result, 0));
+
+    if (result < 0 && errno == EINTR)
+      {
+      continue;
+      }
+
+    if (result < (ssize_t)wanted)
+      {
+      break;
+      }
+    }
+
+  if (incoming.empty())
+    {
+    return false;
+    }
+
+  std::lock_guard<std::mutex> l(_lock);
+  auto &buffer = stream.buffer;
+  if (!buffer.empty())
+    {
+    buffer.insert(buffer.end(), incoming.begin(), incoming.end());
+    return false;
+    }
+
+  // Hand over the storage that was read into, and keep the drained buffer's to read into next.
+  buffer.swap(incoming);
+  return true;
+  }
+
+}
@@ -0,0 +1,277 @@
+#include "MemoryCache.h"
+#include "lldb/API/SBDebugger.h"
+#include "lldb/API/SBError.h"
+#include <algorithm>
+#include <cstring>
+
+namespace LldbDriver
+{
+
+namespace
+{
+
+const uint64_t pageMask = ~(uint64_t)(MemoryCache::PageSize - 1);
+
+bool canRead(lldb::SBProcess &process)
+  {
+  // Reads fail while running, and those failures mustn't be cached as unreadable pages.
+  return process.IsValid() && lldb::SBDebugger::StateIsStoppedState(process.GetState());
+  }
+
+}
+
+MemoryCache::MemoryCache()
+    : _stopId(~(uint32_t)0),
+      _generation(0),
+      _busy(false),
+      _quit(false)
+  {
+  _reader = std::thread([this]() { run(); });
+  }
+
+MemoryCache::~MemoryCache()
+  {
+  {
+  std::lock_guard<std::mutex> l(_lock);
+  _quit = true;
+  _jobs.clear();
+  ++_generation;
+  }
+  _wake.notify_all();
+
+  _reader.join();
+  }
+
+void MemoryCache::invalidate()
+  {
+  std::lock_guard<std::mutex> l(_lock);
+  clearPages();
+  _jobs.clear();
+  ++_generation;
+  }
+
+void MemoryCache::clearPages()
+  {
+  _pages.clear();
+  _used.clear();
+  }
+
+size_t MemoryCache::read(lldb::SBProcess process, uint64_t address, uint8_t *data, size_t size)
+  {
+  if (!canRead(process))
+    {
+    return 0;
+    }
+
+  uint32_t stopId = process.GetStopID();
+  std::vector<uint8_t> buffer;
+
+  std::unique_lock<std::mutex> l(_lock);
+  if (stopId != _stopId)
+    {
+    clearPages();
+    _stopId = stopId;
+    }
+
+  size_t done = 0;
+  while (done < size)
+    {
+    uint64_t at = address + done;
+    if (at < address)
+      {
+      // Wrapped past the top of the address space.
+      break;
+      }
+
+    uint64_t pageAddress = at & pageMask;
+    size_t offset = (size_t)(at - pageAddress);
+    size_t count = std::min<size_t>(size - done, PageSize - offset);
+
+    auto found = _pages.find(pageAddress);
+    if (found == _pages.end())
+      {
+      size_t wanted = (offset + (size - done) + PageSize - 1) / PageSize;
+      size_t run = missingRun(pageAddress, wanted);
+
+      // Reading the process is slow, let other readers use the cache meanwhile.
+      l.unlock();
+      bool failedReadable = false;
+      size_t whole = readRun(process, pageAddress, run, buffer, failedReadable);
+      l.lock();
+
+      if (_stopId != stopId)
+        {
+        // Stopped again while reading, what was read may already be out of date.
+        break;
+        }
+
+      storeRun(pageAddress, run, buffer, whole, failedReadable);
+      found = _pages.find(pageAddress);
+      }
+
+    _used.splice(_used.begin(), _used, found->second.used);
+    if (!found->second.readable)
+      {
+      break;
+      }
+
+    memcpy(data + done, found->second.bytes.data() + offset, count);
+    done += count;
+    }
+
+  return done;
+  }
+
+void MemoryCache::readAsync(lldb::SBProcess process, uint64_t address, size_t size, size_t chunkSize, const ChunkCallback &chunk)
+  {
+  {
+  std::lock_guard<std::mutex> l(_lock);
+
+  Job job;
+  job.process = process;
+  job.address = address;
+  job.size = size;
+  job.chunkSize = std::max<size_t>(chunkSize, 1);
+  job.chunk = chunk;
+  job.generation = _generation;
+  _jobs.push_back(std::move(job));
+  }
+
+  _wake.notify_one();
+  }
+
+void MemoryCache::cancel()
+  {
+  std::unique_lock<std::mutex> l(_lock);
+  _jobs.clear();
+  ++_generation;
+
+  _idle.wait(l, [this]() { return !_busy; });
+  }
+
+size_t MemoryCache::missingRun(uint64_t address, size_t wanted) const
+  {
+  // Read the run of missing pages from here in one go, up to the next page already known.
+  size_t count = std::min<size_t>(std::max<size_t>(wanted, ReadAheadPages), MaxRunPages);
+  for (size_t i = 1; i < count; ++i)
+    {
+    uint64_t next = address + i * PageSize;
+    if (next < address || _pages.count(next))
+      {
+      return i;
+      }
+    }
+
+  return count;
+  }
+
+size_t MemoryCache::readRun(lldb::SBProcess &process, uint64_t address, size_t count, std::vector<uint8_t> &buffer, bool &failedReadable)
+  {
+  buffer.resize(count * PageSize);
+
+  lldb::SBError error;
+  size_t read = process.ReadMemory(address, buffer.data(), buffer.size(), error);
+
+  // A run can end in unmapped memory, the pages before that are still good.
+  size_t whole = std::min(read, buffer.size()) / PageSize;
+  if (whole == count)
+    {
+    return whole;
+    }
+
+  // Find out about the page it stopped in on its own, the pages after it are read when asked for.
+  uint64_t failed = address + whole * PageSize;
+  lldb::SBError pageError;
+  failedReadable = process.ReadMemory(failed, buffer.data() + whole * PageSize, PageSize, pageError) == PageSize;
+  return whole;
+  }
+
+void MemoryCache::storeRun(uint64_t address, size_t count, const std::vector<uint8_t> &buffer, size_t whole, bool failedReadable)
+  {
+  for (size_t i = 0; i < whole; ++i)
+    {
+    store(address + i * PageSize, buffer.data() + i * PageSize, true);
+    }
+
+  if (whole < count)
+    {
+    store(address + whole * PageSize, buffer.data() + whole * PageSize, failedReadable);
+    }
+  }
+
+void MemoryCache::store(uint64_t address, const uint8_t *data, bool readable)
+  {
+  if (_pages.count(address))
+    {
+    // Another reader filled it while this one was reading, from the same stop.
+    return;
+    }
+
+  while (_pages.size() >= MaxPages && !_used.empty())
+    {
+    _pages.erase(_used.back());
+    _used.pop_back();
+    }
+
+  _used.push_front(address);
+
+  auto &page = _pages[address];
+  page.readable = readable;
+  page.used = _used.begin();
+  if (readable)
+    {
+    page.bytes.assign(data, data + PageSize);
+    }
+  }
+
+void MemoryCache::run()
+  {
+  std::vector<uint8_t> chunk;
+
+  std::unique_lock<std::mutex> l(_lock);
+  while (true)
+    {
+    _wake.wait(l, [this]() { return _quit || !_jobs.empty(); });
+    if (_quit)
+      {
+      return;
+      }
+
+    Job job = std::move(_jobs.front());
+    _jobs.pop_front();
+    _busy = true;
+
+    for (uint64_t offset = 0; offset < job.size && job.generation == _generation; offset += job.chunkSize)
+      {
+      size_t size = (size_t)std::min<uint64_t>(job.chunkSize, job.size - offset);
+      chunk.resize(size);
+
+      // read takes the lock itself, and others can read between the chunks.
+      l.unlock();
+      size_t read = this->read(job.process, job.address + offset, chunk.data(), size);
+      l.lock();
+
+      if (job.generation != _generation)
+        {
+        break;
+        }
+
+      if (job.chunk && read)
+        {
+        l.unlock();
+        job.chunk(job.address + offset, chunk.data(), read);
+        l.lock();
+        }
+
+      if (read < size)
+        {
+        break;
+        }
+      }
+
+    _busy = false;
+    _idle.notify_all();
+    }
+  }
+
+}
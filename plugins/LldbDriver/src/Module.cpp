@@ -2,6 +2,7 @@
 #include "ModuleImpl.h"
 #include "CompileUnit.h"
 #include "CompileUnitImpl.h"
+#include "TypeImpl.h"
 #include "Utils.h"
 
 namespace LldbDriver
@@ -23,6 +24,18 @@ Eks::String Module::path() const
   return fileSpecAsString(file);
   }
 
+Eks::String Module::uuid() const
+  {
+  std::lock_guard<std::mutex> l(_impl->mutex);
+
+  auto uuid = _impl->module.GetUUIDString();
+  if (!uuid)
+    {
+    return Eks::String();
+    }
+  return uuid;
+  }
+
 std::set<Eks::String> Module::files() const
   {
   std::set<Eks::String> set;
@@ -75,5 +88,20 @@ const std::vector<std::shared_ptr<LldbDriver::CompileUnit>> &Module::compileUnit
   return _impl->compileUnits;
   }
 
+Eks::Vector<Type> Module::findTypes(const char *name) const
+  {
+  Eks::Vector<Type> result(Eks::Core::defaultAllocator());
+
+  std::lock_guard<std::mutex> l(_impl->mutex);
+  auto types = _impl->module.FindTypes(name);
+
+  result.resize(types.GetSize());
+  for (uint32_t i = 0; i < types.GetSize(); ++i)
+    {
+    result[i] = Type::Impl::make(nullptr, types.GetTypeAtIndex(i));
+    }
+
+  return result;
+  }
 
 }
@@ -2,15 +2,24 @@
 #include "ProcessImpl.h"
 #include "Error.h"
 #include "ErrorImpl.h"
-#include "lldb/API/SBEvent.h"
+#include "StopSnapshot.h"
 #include "lldb/API/SBStream.h"
 #include "lldb/API/SBDebugger.h"
-#include <array>
+#include <cstring>
 
 namespace LldbDriver
 {
 xCompileTimeAssert((int)ProcessState::Suspended == 11);
 
+namespace
+{
+
+const size_t outputReadSize = 64 * 1024;
+// A burst of output can grow the drain buffers a lot, don't hold on to more than this between drains.
+const size_t outputRetainedSize = 1024 * 1024;
+
+}
+
 Process::Process()
   {
   }
@@ -50,25 +59,65 @@ NoArgNotifier *Process::errorAvailable()
   return &_impl->errorAvailable;
   }
 
-void Process::getOutputs(Eks::String &out, Eks::String &err)
+NoArgNotifier *Process::breakpointLogAvailable()
   {
-  auto forwardOutput = [this](auto type, auto &send)
+  return &_impl->breakpointLogAvailable;
+  }
+
+void Process::getOutputs(Eks::String &out, Eks::String &err)
   {
-    std::array<char, 256> output;
-    while (size_t read = getOutput(type, output.data(), output.size()-1))
+  auto forwardOutput = [this](auto type, std::vector<char> &buffer, auto &send)
+    {
+    buffer.clear();
+    if (auto drained = drainOutput(type, buffer))
       {
-      xAssert(read <= (output.size()-1));
-      output[read] = '\0';
-      send += output.data();
+      // Output is bytes rather than a string, and may hold NULs, so append it by length.
+      send.insert(send.end(), buffer.data(), buffer.data() + drained);
+      }
+
+    if (buffer.capacity() > outputRetainedSize)
+      {
+      std::vector<char>().swap(buffer);
       }
     };
 
-  forwardOutput(Process::OutputType::Output, out);
-  forwardOutput(Process::OutputType::Error, err);
+  forwardOutput(Process::OutputType::Output, _impl->outputBuffer, out);
+  forwardOutput(Process::OutputType::Error, _impl->errorBuffer, err);
+  }
+
+size_t Process::drainOutput(Process::OutputType type, std::vector<char> &buffer)
+  {
+  if (_impl->stdio)
+    {
+    return _impl->stdio->drain(type, buffer);
+    }
+
+  const size_t start = buffer.size();
+  size_t size = start;
+  for (;;)
+    {
+    buffer.resize(size + outputReadSize);
+    size_t read = getOutput(type, buffer.data() + size, outputReadSize);
+    xAssert(read <= outputReadSize);
+    size += read;
+
+    if (read == 0)
+      {
+      break;
+      }
+    }
+
+  buffer.resize(size);
+  return size - start;
   }
 
 size_t Process::getOutput(Process::OutputType type, char *data, size_t inputSize)
   {
+  if (_impl->stdio)
+    {
+    return _impl->stdio->read(type, data, inputSize);
+    }
+
   if (type == OutputType::Error)
     {
     return _impl->process.GetSTDERR(data, inputSize);
@@ -81,6 +130,52 @@ size_t Process::getOutput(Process::OutputType type, char *data, size_t inputSize
   return 0;
   }
 
+void Process::writeInput(const Eks::String &input)
+  {
+  const char *data = input.data();
+  if (!data)
+    {
+    return;
+    }
+
+  size_t size = strlen(data);
+  if (_impl->stdio)
+    {
+    _impl->stdio->write(data, size);
+    return;
+    }
+
+  _impl->process.PutSTDIN(data, size);
+  }
+
+Eks::Vector<uint8_t> Process::readMemory(uint64_t address, size_t size)
+  {
+  Eks::Vector<uint8_t> result(Eks::Core::defaultAllocator());
+  if (size == 0)
+    {
+    return result;
+    }
+
+  result.resize(size);
+  result.resize(readMemory(address, &result[0], size));
+  return result;
+  }
+
+size_t Process::readMemory(uint64_t address, uint8_t *data, size_t size)
+  {
+  return _impl->memory.read(_impl->process, address, data, size);
+  }
+
+void Process::readMemoryAsync(uint64_t address, size_t size, size_t chunkSize, const MemoryChunkCallback &chunk)
+  {
+  _impl->memory.readAsync(_impl->process, address, size, chunkSize, chunk);
+  }
+
+void Process::cancelMemoryReads()
+  {
+  _impl->memory.cancel();
+  }
+
 Error Process::kill()
   {
   auto err = _impl->process.Kill();
@@ -95,6 +190,7 @@ Error Process::pauseExecution()
 
 Error Process::continueExecution()
   {
+  _impl->memory.invalidate();
   auto err = _impl->process.Continue();
   return Error::Helper::makeError(err);
   }
@@ -117,22 +213,29 @@ Eks::String Process::exitDescription() const
 
 void Process::processEvents()
   {
-  lldb::SBEvent ev;
-  while (_impl->listener.GetNextEvent(ev))
+  // Clear before draining, so events pushed during the drain schedule another call.
+  _impl->eventsPending = false;
+
+  Impl::Event ev;
+  while (_impl->events.pop(ev))
     {
-    if (ev.GetType() == lldb::SBProcess::eBroadcastBitSTDOUT)
+    if (ev.type == Impl::Event::Output)
       {
       _impl->outputAvailable();
       }
-      if (ev.GetType() == lldb::SBProcess::eBroadcastBitSTDERR)
-        {
-        _impl->errorAvailable();
-        }
-
-    if (lldb::SBProcess::EventIsProcessEvent(ev) &&
-        lldb::SBProcess::GetStateFromEvent(ev) != _impl->processState)
+    else if (ev.type == Impl::Event::Error)
+      {
+      _impl->errorAvailable();
+      }
+    else if (ev.type == Impl::Event::BreakpointLog)
+      {
+      _impl->breakpointLogAvailable();
+      }
+    else if (ev.type == Impl::Event::StateChanged && ev.state != _impl->processState)
       {
-      _impl->processState = _impl->process.GetState();
+      _impl->processState = ev.state;
+      _impl->snapshot = nullptr;
+      _impl->memory.invalidate();
 
       _impl->stateChanged((ProcessState)_impl->processState);
       if (currentState() == ProcessState::Invalid)
@@ -143,6 +246,12 @@ void Process::processEvents()
     }
   }
 
+void Process::setEventsAvailableCallback(const std::function<void ()> &fn)
+  {
+  std::lock_guard<std::mutex> l(_impl->eventCallbackLock);
+  _impl->eventCallback = fn;
+  }
+
 ProcessStateChangeNotifier *Process::stateChanged()
   {
   return &_impl->stateChanged;
@@ -173,10 +282,27 @@ void Process::selectThread(const std::shared_ptr<Thread> &t)
     }
 
   _impl->process.SetSelectedThread(t->_impl->thread);
+  _impl->snapshot = nullptr;
   }
 
 std::shared_ptr<Thread> Process::selectedThread()
   {
   return _impl->wrapThread(_impl->process.GetSelectedThread());
   }
+
+std::shared_ptr<StopSnapshot> Process::stopSnapshot()
+  {
+  if (currentState() != ProcessState::Stopped)
+    {
+    return nullptr;
+    }
+
+  if (!_impl->snapshot)
+    {
+    _impl->snapshot = StopSnapshot::capture(*this, _impl->snapshotFrameLimit);
+    }
+
+  return _impl->snapshot;
+  }
+
 }
@@ -0,0 +1,161 @@
+#include "StopSnapshot.h"
+#include "StopSnapshotImpl.h"
+#include "ProcessImpl.h"
+#include "ThreadImpl.h"
+#include "FrameImpl.h"
+#include <algorithm>
+
+namespace LldbDriver
+{
+
+StopSnapshot::StopSnapshot()
+  {
+  }
+
+StopSnapshot::~StopSnapshot()
+  {
+  }
+
+StopSnapshot::Pointer StopSnapshot::capture(Process &process, size_t maxFrames)
+  {
+  auto snapshot = std::make_shared<StopSnapshot>();
+  auto &impl = *snapshot->_impl;
+  impl.process = process._impl->myself;
+
+  auto selected = process.selectedThread();
+  size_t selectedId = selected ? selected->id() : 0;
+
+  auto threadCount = process.threadCount();
+  impl.threads.resize(threadCount);
+  impl.selectedThread = threadCount;
+
+  for (size_t i = 0; i < threadCount; ++i)
+    {
+    auto &data = impl.threads[i];
+    auto thread = process.threadAt(i);
+    data.thread = thread->_impl->thread;
+    data.id = thread->id();
+    data.name = thread->name();
+    data.totalFrames = thread->frameCount();
+
+    if (selected && data.id == selectedId)
+      {
+      impl.selectedThread = i;
+      }
+
+    auto selectedFrameId = thread->selectedFrame().id();
+
+    auto frameCount = std::min(data.totalFrames, maxFrames);
+    data.frames.reserve(frameCount);
+    data.selectedFrame = frameCount;
+
+    for (size_t f = 0; f < frameCount; ++f)
+      {
+      auto frame = thread->frameAt(f);
+      if (frame.id() == selectedFrameId)
+        {
+        data.selectedFrame = f;
+        }
+
+      data.frames.push_back(Impl::FrameData{
+        frame._impl->frame,
+        frame.functionName(),
+        frame.filename(),
+        frame.hasLineNumber(),
+        frame.lineNumber()
+        });
+      }
+    }
+
+  return snapshot;
+  }
+
+size_t StopSnapshot::threadCount() const
+  {
+  return _impl->threads.size();
+  }
+
+std::shared_ptr<Thread> StopSnapshot::thread(size_t thread) const
+  {
+  auto data = _impl->findThread(thread);
+  auto process = _impl->process.lock();
+  if (!data || !process)
+    {
+    return nullptr;
+    }
+
+  return process->_impl->wrapThread(data->thread);
+  }
+
+size_t StopSnapshot::threadID(size_t thread) const
+  {
+  auto data = _impl->findThread(thread);
+  return data ? data->id : 0;
+  }
+
+Eks::String StopSnapshot::threadName(size_t thread) const
+  {
+  auto data = _impl->findThread(thread);
+  return data ? data->name : Eks::String();
+  }
+
+size_t StopSnapshot::selectedThread() const
+  {
+  return _impl->selectedThread;
+  }
+
+size_t StopSnapshot::frameCount(size_t thread) const
+  {
+  auto data = _impl->findThread(thread);
+  return data ? data->frames.size() : 0;
+  }
+
+size_t StopSnapshot::totalFrameCount(size_t thread) const
+  {
+  auto data = _impl->findThread(thread);
+  return data ? data->totalFrames : 0;
+  }
+
+size_t StopSnapshot::selectedFrame(size_t thread) const
+  {
+  auto data = _impl->findThread(thread);
+  return data ? data->selectedFrame : 0;
+  }
+
+Frame StopSnapshot::frame(size_t thread, size_t frame) const
+  {
+  auto data = _impl->findFrame(thread, frame);
+  auto owner = data ? this->thread(thread) : nullptr;
+  if (!owner)
+    {
+    return Frame();
+    }
+
+  return owner->_impl->make(data->frame);
+  }
+
+Eks::String StopSnapshot::functionName(size_t thread, size_t frame) const
+  {
+  auto data = _impl->findFrame(thread, frame);
+  return data ? data->functionName : Eks::String();
+  }
+
+Eks::String StopSnapshot::filename(size_t thread, size_t frame) const
+  {
+  auto data = _impl->findFrame(thread, frame);
+  return data ? data->filename : Eks::String();
+  }
+
+bool StopSnapshot::hasLineNumber(size_t thread, size_t frame) const
+  {
+  auto data = _impl->findFrame(thread, frame);
+  return data && data->hasLineNumber;
+  }
+
+size_t StopSnapshot::lineNumber(size_t thread, size_t frame) const
+  {
+  auto data = _impl->findFrame(thread, frame);
+  return data ? data->lineNumber : 0;
+  }
+
+}
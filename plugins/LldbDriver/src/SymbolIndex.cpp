@@ -0,0 +1,551 @@
+#include "SymbolIndex.h"
+#include "SymbolIndexImpl.h"
+#include "ModuleImpl.h"
+#include "Target.h"
+#include "Utils.h"
+#include "Math/XMathHelpers.h"
+#include "lldb/API/SBCompileUnit.h"
+#include "lldb/API/SBFunction.h"
+#include "lldb/API/SBLineEntry.h"
+#include "lldb/API/SBSymbol.h"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace LldbDriver
+{
+
+namespace
+{
+
+bool isBoundary(char previous, char current)
+  {
+  if (!std::isalnum((unsigned char)previous))
+    {
+    return true;
+    }
+
+  return std::islower((unsigned char)previous) && std::isupper((unsigned char)current);
+  }
+
+// Score [query] matched in order against [lower], starting at [start].
+int scoreFrom(const char *name, const char *lower, size_t length, const char *query, size_t queryLength, size_t start)
+  {
+  int score = 0;
+  size_t q = 0;
+  size_t last = start;
+  for (size_t i = start; i < length && q < queryLength; ++i)
+    {
+    if (lower[i] != query[q])
+      {
+      continue;
+      }
+
+    int bonus = 1;
+    if (i == 0)
+      {
+      bonus += 8;
+      }
+    else if (isBoundary(name[i - 1], name[i]))
+      {
+      bonus += 6;
+      }
+
+    if (q > 0 && last + 1 == i)
+      {
+      bonus += 4;
+      }
+
+    score += bonus;
+    last = i;
+    ++q;
+    }
+
+  return q == queryLength ? score : -1;
+  }
+
+// Score [query] as a fuzzy match for a name, or return -1 if it isn't a subsequence of it.
+int score(const char *name, const char *lower, size_t length, const char *query, size_t queryLength)
+  {
+  // Matching greedily from the first character misses better alignments later on
+  // ("foo" against "format_foo"), so also try each word boundary the query could start at.
+  int best = scoreFrom(name, lower, length, query, queryLength, 0);
+  if (best < 0)
+    {
+    return -1;
+    }
+
+  for (size_t i = 1; i + queryLength <= length; ++i)
+    {
+    if (lower[i] == query[0] && isBoundary(name[i - 1], name[i]))
+      {
+      best = std::max(best, scoreFrom(name, lower, length, query, queryLength, i));
+      }
+    }
+
+  if (length == queryLength)
+    {
+    best += 32;
+    }
+
+  // Prefer shorter names between otherwise equal matches.
+  return best * 16 - (int)(std::min<size_t>(length, 255) / 8);
+  }
+
+}
+
+SymbolIndex::SymbolIndex()
+  {
+  }
+
+SymbolIndex::~SymbolIndex()
+  {
+  }
+
+SymbolIndex::Pointer SymbolIndex::create(const std::shared_ptr<Target> &target)
+  {
+  auto index = std::make_shared<SymbolIndex>();
+  auto &impl = *index->_impl;
+
+  impl.target = target;
+  impl.files.push_back(Eks::String());
+
+  index->refresh();
+  return index;
+  }
+
+void SymbolIndex::refresh()
+  {
+  auto target = _impl->target.lock();
+  if (!target)
+    {
+    return;
+    }
+
+  std::vector<Module::Pointer> modules;
+  auto moduleCount = target->moduleCount();
+  modules.reserve(moduleCount);
+  for (size_t i = 0; i < moduleCount; ++i)
+    {
+    if (auto module = target->moduleAt(i))
+      {
+      modules.push_back(module);
+      }
+    }
+
+  std::lock_guard<std::mutex> l(_impl->lock);
+  xForeach(const auto &module, modules)
+    {
+    _impl->moduleIndex(module);
+    }
+  }
+
+void SymbolIndex::addType(const std::shared_ptr<Module> &module, const char *name, const char *file, size_t line)
+  {
+  if (!module || !name || !*name)
+    {
+    return;
+    }
+
+  std::lock_guard<std::mutex> l(_impl->lock);
+
+  // One entry per type, declared by whichever module reported it first.
+  // The first declaration may have come from an index without a location, so fill that in later.
+  auto existing = _impl->typeEntries.find(name);
+  if (existing != _impl->typeEntries.end())
+    {
+    auto &entry = _impl->entries[existing->second];
+    if (entry.file == 0 && file && *file)
+      {
+      entry.file = _impl->fileIndex(file);
+      entry.line = (uint32_t)line;
+      }
+    return;
+    }
+
+  auto moduleIndex = _impl->moduleIndex(module);
+  auto fileIndex = file && *file ? _impl->fileIndex(file) : 0;
+
+  _impl->typeEntries[name] = (uint32_t)_impl->entries.size();
+  _impl->addName(name, moduleIndex, Impl::NoSymbol, fileIndex, (uint32_t)line, Impl::Structure);
+  }
+
+bool SymbolIndex::isReady() const
+  {
+  std::lock_guard<std::mutex> l(_impl->lock);
+  return !_impl->building && _impl->pending.empty();
+  }
+
+size_t SymbolIndex::symbolCount() const
+  {
+  std::lock_guard<std::mutex> l(_impl->lock);
+  return _impl->entries.size();
+  }
+
+Eks::Vector<SymbolMatch> SymbolIndex::find(const char *query, size_t maxResults) const
+  {
+  Eks::Vector<SymbolMatch> result(Eks::Core::defaultAllocator());
+  if (!query || maxResults == 0)
+    {
+    return result;
+    }
+
+  std::string lowerQuery;
+  for (const char *c = query; *c; ++c)
+    {
+    if (!std::isspace((unsigned char)*c))
+      {
+      lowerQuery.push_back((char)std::tolower((unsigned char)*c));
+      }
+    }
+
+  if (lowerQuery.empty())
+    {
+    return result;
+    }
+
+  auto queryMask = Impl::charMask(lowerQuery.data(), lowerQuery.size());
+
+  std::vector<std::pair<int, uint32_t>> scored;
+  std::vector<uint32_t> matches;
+  auto check = [&](uint32_t i)
+    {
+    const auto &entry = _impl->entries[i];
+    if ((entry.mask & queryMask) != queryMask || entry.length < lowerQuery.size())
+      {
+      return;
+      }
+
+    int s = score(
+      _impl->names.data() + entry.name,
+      _impl->lowerNames.data() + entry.name,
+      entry.length,
+      lowerQuery.data(),
+      lowerQuery.size());
+    if (s >= 0)
+      {
+      scored.emplace_back(s, i);
+      matches.push_back(i);
+      }
+    };
+
+  // Symbol locations are looked up once the index is unlocked, so the builder isn't held up behind lldb.
+  std::vector<std::pair<Module::Pointer, uint32_t>> symbols;
+
+  {
+  std::lock_guard<std::mutex> l(_impl->lock);
+
+  auto &last = _impl->lastQuery;
+  auto entryCount = (uint32_t)_impl->entries.size();
+  if (!last.empty() && lowerQuery.compare(0, last.size(), last) == 0)
+    {
+    xForeach(auto i, _impl->lastMatches)
+      {
+      check(i);
+      }
+
+    for (uint32_t i = (uint32_t)_impl->lastEntryCount; i < entryCount; ++i)
+      {
+      check(i);
+      }
+    }
+  else
+    {
+    for (uint32_t i = 0; i < entryCount; ++i)
+      {
+      check(i);
+      }
+    }
+
+  _impl->lastQuery = lowerQuery;
+  _impl->lastMatches.swap(matches);
+  _impl->lastEntryCount = entryCount;
+
+  auto count = std::min(maxResults, scored.size());
+  std::partial_sort(scored.begin(), scored.begin() + count, scored.end(), [](const auto &a, const auto &b)
+    {
+    if (a.first != b.first)
+      {
+      return a.first > b.first;
+      }
+    return a.second < b.second;
+    });
+
+  result.resize(count);
+  symbols.resize(count);
+  for (size_t i = 0; i < count; ++i)
+    {
+    const auto &entry = _impl->entries[scored[i].second];
+
+    auto &match = result[i];
+    match._name = _impl->names.data() + entry.name;
+    match._score = scored[i].first;
+    match._isType = entry.kind == Impl::Structure;
+
+    symbols[i] = std::make_pair(_impl->modules[entry.module], entry.symbol);
+    if (entry.symbol == Impl::NoSymbol)
+      {
+      match._filename = _impl->files[entry.file];
+      match._hasLineNumber = entry.line != 0;
+      match._lineNumber = entry.line;
+      }
+    }
+  }
+
+  // Locations are only worth looking up for the results shown.
+  for (size_t i = 0; i < symbols.size(); ++i)
+    {
+    const auto &module = symbols[i].first;
+    auto &match = result[i];
+    match._modulePath = module->path();
+
+    if (symbols[i].second == Impl::NoSymbol)
+      {
+      continue;
+      }
+
+    std::lock_guard<std::mutex> l(module->_impl->mutex);
+    auto symbol = module->_impl->module.GetSymbolAtIndex(symbols[i].second);
+    auto line = symbol.GetStartAddress().GetLineEntry();
+    if (line.IsValid())
+      {
+      match._filename = fileSpecAsString(line.GetFileSpec());
+      match._hasLineNumber = line.GetLine() != Eks::maxFor<uint32_t>();
+      match._lineNumber = line.GetLine();
+      }
+    }
+
+  return result;
+  }
+
+void SymbolIndex::Impl::build()
+  {
+  for (;;)
+    {
+    uint32_t index;
+    Module::Pointer module;
+
+    {
+    std::lock_guard<std::mutex> l(lock);
+    if (cancelled || pending.empty())
+      {
+      building = false;
+      return;
+      }
+
+    index = pending.front();
+    pending.pop_front();
+    module = modules[index];
+    }
+
+    addModule(index, module);
+    }
+  }
+
+void SymbolIndex::Impl::addModule(uint32_t index, const Module::Pointer &module)
+  {
+  // The module's lock is shared with the gui thread and the type workers, so it is
+  // only taken for a batch of symbols, or a compile unit, at a time.
+  auto &mod = module->_impl->module;
+
+  // Overloads and local copies share a name, one entry per name per module is enough to find them.
+  std::unordered_set<std::string> seen;
+  std::vector<Found> found;
+
+  uint32_t symbolCount;
+  uint32_t unitCount;
+  {
+  std::lock_guard<std::mutex> l(module->_impl->mutex);
+  symbolCount = (uint32_t)mod.GetNumSymbols();
+  unitCount = mod.GetNumCompileUnits();
+  }
+
+  for (uint32_t begin = 0; begin < symbolCount && !cancelled; begin += SymbolBatchSize)
+    {
+    found.clear();
+
+    {
+    std::lock_guard<std::mutex> l(module->_impl->mutex);
+    auto end = std::min<uint32_t>(begin + SymbolBatchSize, symbolCount);
+    for (uint32_t i = begin; i < end; ++i)
+      {
+      auto symbol = mod.GetSymbolAtIndex(i);
+
+      Kind kind;
+      switch (symbol.GetType())
+        {
+      case lldb::eSymbolTypeCode:
+        kind = Function;
+        break;
+      case lldb::eSymbolTypeData:
+        kind = Data;
+        break;
+      default:
+        continue;
+        }
+
+      const char *name = symbol.GetDisplayName();
+      if (!name || !*name)
+        {
+        name = symbol.GetName();
+        }
+
+      if (!name || !*name || !seen.insert(name).second)
+        {
+        continue;
+        }
+
+      found.push_back(Found{ name, i, kind, std::string(), 0 });
+      }
+    }
+
+    store(index, found);
+    }
+
+  // Functions with debug info but no symbol, statics in a stripped symbol table for instance,
+  // are found by walking each unit's line table, once per function rather than per line.
+  for (uint32_t i = 0; i < unitCount && !cancelled; ++i)
+    {
+    found.clear();
+
+    {
+    std::lock_guard<std::mutex> l(module->_impl->mutex);
+    auto unit = mod.GetCompileUnitAtIndex(i);
+
+    lldb::addr_t functionBegin = LLDB_INVALID_ADDRESS;
+    lldb::addr_t functionEnd = LLDB_INVALID_ADDRESS;
+    auto lineCount = unit.GetNumLineEntries();
+    for (uint32_t l = 0; l < lineCount; ++l)
+      {
+      auto address = unit.GetLineEntryAtIndex(l).GetStartAddress();
+      auto fileAddress = address.GetFileAddress();
+      if (functionBegin != LLDB_INVALID_ADDRESS && fileAddress >= functionBegin && fileAddress < functionEnd)
+        {
+        continue;
+        }
+
+      auto function = address.GetFunction();
+      if (!function.IsValid())
+        {
+        continue;
+        }
+
+      functionBegin = function.GetStartAddress().GetFileAddress();
+      functionEnd = function.GetEndAddress().GetFileAddress();
+
+      const char *name = function.GetDisplayName();
+      if (!name || !*name)
+        {
+        name = function.GetName();
+        }
+
+      if (!name || !*name || !seen.insert(name).second)
+        {
+        continue;
+        }
+
+      Found entry{ name, NoSymbol, Function, std::string(), 0 };
+      auto declaration = function.GetStartAddress().GetLineEntry();
+      if (declaration.IsValid())
+        {
+        Eks::String path = fileSpecAsString(declaration.GetFileSpec());
+        entry.file = path.data();
+        entry.line = declaration.GetLine();
+        }
+
+      found.push_back(entry);
+      }
+    }
+
+    store(index, found);
+    }
+  }
+
+void SymbolIndex::Impl::store(uint32_t module, const std::vector<Found> &found)
+  {
+  if (found.empty())
+    {
+    return;
+    }
+
+  std::lock_guard<std::mutex> l(lock);
+  xForeach(const auto &entry, found)
+    {
+    auto file = entry.file.empty() ? 0 : fileIndex(entry.file);
+    addName(entry.name.data(), module, entry.symbol, file, entry.line, entry.kind);
+    }
+  }
+
+uint32_t SymbolIndex::Impl::moduleIndex(const Module::Pointer &module)
+  {
+  auto existing = moduleIds.find(module.get());
+  if (existing != moduleIds.end())
+    {
+    return existing->second;
+    }
+
+  auto index = (uint32_t)modules.size();
+  modules.push_back(module);
+  moduleIds[module.get()] = index;
+  pending.push_back(index);
+
+  if (!building)
+    {
+    // A previous builder has already cleared building, and is only returning.
+    if (builder.joinable())
+      {
+      builder.join();
+      }
+
+    building = true;
+    builder = std::thread([this]() { build(); });
+    }
+
+  return index;
+  }
+
+uint32_t SymbolIndex::Impl::fileIndex(const std::string &file)
+  {
+  auto inserted = fileIds.emplace(file, (uint32_t)files.size());
+  if (inserted.second)
+    {
+    files.push_back(file.data());
+    }
+  return inserted.first->second;
+  }
+
+void SymbolIndex::Impl::addName(const char *name, uint32_t module, uint32_t symbol, uint32_t file, uint32_t line, Kind kind)
+  {
+  size_t length = strlen(name);
+
+  Entry entry;
+  entry.name = names.size();
+  entry.length = (uint32_t)length;
+  entry.module = module;
+  entry.symbol = symbol;
+  entry.file = file;
+  entry.line = line;
+  entry.kind = kind;
+
+  names.insert(names.end(), name, name + length + 1);
+  for (size_t i = 0; i < length; ++i)
+    {
+    lowerNames.push_back((char)std::tolower((unsigned char)name[i]));
+    }
+  lowerNames.push_back('\0');
+
+  entry.mask = charMask(lowerNames.data() + entry.name, length);
+  entries.push_back(entry);
+  }
+
+SymbolMatch::SymbolMatch()
+    : _hasLineNumber(false),
+      _lineNumber(0),
+      _isType(false),
+      _score(0)
+  {
+  }
+
+}
@@ -5,12 +5,43 @@
 #include "ErrorImpl.h"
 #include <iostream>
 #include "lldb/API/SBBreakpointLocation.h"
+#include "lldb/API/SBFrame.h"
 #include "lldb/API/SBModuleSpec.h"
+#include "lldb/API/SBThread.h"
+#include "lldb/API/SBValue.h"
 #include "Utils.h"
 
 namespace LldbDriver
 {
 
+BreakpointChange::BreakpointChange()
+    : _type(Type::Modified),
+      _breakpoint(0)
+  {
+  }
+
+Eks::Vector<int> BreakpointChange::locations() const
+  {
+  Eks::Vector<int> result(Eks::Core::defaultAllocator());
+  result.resize(_locations.size());
+  for (size_t i = 0; i < _locations.size(); ++i)
+    {
+    result[i] = _locations[i];
+    }
+  return result;
+  }
+
+Eks::Vector<Eks::String> BreakpointChange::files() const
+  {
+  Eks::Vector<Eks::String> result(Eks::Core::defaultAllocator());
+  result.resize(_files.size());
+  for (size_t i = 0; i < _files.size(); ++i)
+    {
+    result[i] = *_files[i];
+    }
+  return result;
+  }
+
 Target::Target()
   {
   }
@@ -61,6 +92,17 @@ Process::Pointer Target::launch(
   Eks::Vector<const char *> envData(&alloc);
   bake(env, envStorage, envData);
 
+  std::unique_ptr<InferiorStdio> stdio;
+  if (_impl->stdioMode != StdioMode::Debugger)
+    {
+    stdio = InferiorStdio::create(_impl->stdioMode, error);
+    if (!stdio)
+      {
+      err = Error::Helper::makeError(error);
+      return nullptr;
+      }
+    }
+
   process->_impl->myself = process;
   process->_impl->target = _impl->myself.lock();
   process->_impl->listener = lldb::SBListener("ProcessListener");
@@ -68,19 +110,44 @@ Process::Pointer Target::launch(
         process->_impl->listener,
         argsData.data(),
         envData.data(),
-        nullptr,
-        nullptr,
-        nullptr,
+        stdio ? stdio->stdinPath() : nullptr,
+        stdio ? stdio->stdoutPath() : nullptr,
+        stdio ? stdio->stderrPath() : nullptr,
         nullptr,
         lldb::eLaunchFlagNone,
         false,
         error);
   process->_impl->processState = process->_impl->process.GetState();
 
+  if (stdio)
+    {
+    auto impl = &*process->_impl;
+    stdio->start([impl](Process::OutputType type)
+      {
+      Process::Impl::Event ev;
+      ev.type = type == Process::OutputType::Error ? Process::Impl::Event::Error : Process::Impl::Event::Output;
+      impl->post(std::move(ev));
+      });
+    process->_impl->stdio = std::move(stdio);
+    }
+
+  process->_impl->startListening();
+  _impl->setProcess(process);
+
   err = Error::Helper::makeError(error);
   return process;
   }
 
+StdioMode Target::stdioMode() const
+  {
+  return _impl->stdioMode;
+  }
+
+void Target::setStdioMode(StdioMode mode)
+  {
+  _impl->stdioMode = mode;
+  }
+
 std::shared_ptr<Process> Target::attach(uint64_t pid, Error &err)
   {
   lldb::SBError error;
@@ -94,6 +161,8 @@ std::shared_ptr<Process> Target::attach(uint64_t pid, Error &err)
         process->_impl->listener,
         pid,
         error);
+  process->_impl->startListening();
+  _impl->setProcess(process);
 
   err = Error::Helper::makeError(error);
   return process;
@@ -113,6 +182,8 @@ std::shared_ptr<Process> Target::connect(const Eks::String &url, Error &err)
         url.data(),
         nullptr,
         error);
+  process->_impl->startListening();
+  _impl->setProcess(process);
 
   err = Error::Helper::makeError(error);
   return process;
@@ -143,41 +214,85 @@ size_t Target::moduleCount()
 std::shared_ptr<Module> Target::moduleAt(size_t index)
   {
   _impl->cacheModules();
+  if (index >= _impl->modules.size())
+    {
+    return nullptr;
+    }
+
   return _impl->modules[index];
   }
 
 bool Target::findBreakpoint(const Eks::String &file, size_t line, Breakpoint *outBrk, BreakpointLocation *outLoc)
   {
-  auto count = breakpointCount();
-  for (size_t i = 0; i < count; ++i)
+  auto lines = _impl->findLocations(file);
+  if (!lines)
     {
-    auto brk = breakpointAt(i);
+    return false;
+    }
 
-    if (brk.findLocation(file, line, outLoc))
-      {
-      *outBrk = brk;
-      return true;
-      }
+  auto found = lines->find((uint32_t)line);
+  if (found == lines->end())
+    {
+    return false;
     }
-  return false;
+
+  const auto &loc = found->second.front();
+  *outBrk = _impl->make(_impl->target.FindBreakpointByID(loc.breakpoint));
+  *outLoc = loc.location;
+  return true;
+  }
+
+Eks::Vector<size_t> Target::breakpointLines(const Eks::String &file)
+  {
+  Eks::Vector<size_t> result(Eks::Core::defaultAllocator());
+
+  auto lines = _impl->findLocations(file);
+  if (!lines)
+    {
+    return result;
+    }
+
+  result.resize(lines->size());
+  size_t i = 0;
+  xForeach(const auto &line, *lines)
+    {
+    result[i++] = line.first;
+    }
+
+  return result;
   }
 
 Breakpoint Target::addBreakpoint(const Eks::String &file, size_t line)
   {
+  // Start listening before the breakpoint exists, so its added event isn't missed.
+  _impl->syncBreakpoints();
   auto br = _impl->make(_impl->target.BreakpointCreateByLocation(file.data(), line));
 
-  _breakpointsChanged();
+  processEvents();
   return br;
   }
 
 bool Target::removeBreakpoint(const Breakpoint &brk)
   {
+  _impl->syncBreakpoints();
   auto res = _impl->target.BreakpointDelete(brk._impl->breakpoint.GetID());
 
-  _breakpointsChanged();
+  processEvents();
   return res;
   }
 
+void Target::processEvents()
+  {
+  _impl->syncBreakpoints();
+
+  std::vector<BreakpointChange> changes;
+  changes.swap(_impl->pendingChanges);
+  xForeach(const auto &change, changes)
+    {
+    _breakpointsChanged(change);
+    }
+  }
+
 size_t Target::breakpointCount()
   {
   return _impl->target.GetNumBreakpoints();
@@ -187,4 +302,110 @@ Breakpoint Target::breakpointAt(size_t index)
   {
   return _impl->make(_impl->target.GetBreakpointAtIndex(index));
   }
+
+Breakpoint Target::breakpointWithId(size_t id)
+  {
+  return _impl->make(_impl->target.FindBreakpointByID((lldb::break_id_t)id));
+  }
+
+Eks::String Target::takeBreakpointLog()
+  {
+  std::string log;
+  {
+  std::lock_guard<std::mutex> l(_impl->actionLock);
+  log.swap(_impl->breakpointLog);
+  }
+
+  return log.c_str();
+  }
+
+void Target::Impl::setLogMessage(lldb::SBBreakpoint &br, const char *message)
+  {
+  BreakpointAction *baton = nullptr;
+  {
+  std::lock_guard<std::mutex> l(actionLock);
+  auto &action = actions[br.GetID()];
+  if (!action)
+    {
+    action.reset(new BreakpointAction{ this, std::string() });
+    }
+  action->message = message ? message : "";
+  baton = action.get();
+  }
+
+  // Actions live as long as the target, so a callback already running never sees a dead baton.
+  // With an empty message the callback just asks to stop, as if there wasn't one.
+  br.SetCallback(&Impl::breakpointHit, baton);
+  }
+
+void Target::Impl::appendLog(const std::string &line)
+  {
+  bool wasEmpty = false;
+  Process::Pointer p;
+  {
+  std::lock_guard<std::mutex> l(actionLock);
+  wasEmpty = breakpointLog.empty();
+  breakpointLog += line;
+  p = process.lock();
+  }
+
+  // One wake up per batch, the consumer takes everything logged until then.
+  if (wasEmpty && p)
+    {
+    Process::Impl::Event ev;
+    ev.type = Process::Impl::Event::BreakpointLog;
+    p->_impl->post(std::move(ev));
+    }
+  }
+
+bool Target::Impl::breakpointHit(void *baton, lldb::SBProcess &, lldb::SBThread &thread, lldb::SBBreakpointLocation &)
+  {
+  auto action = static_cast<BreakpointAction *>(baton);
+  auto target = action->target;
+
+  std::string message;
+  {
+  std::lock_guard<std::mutex> l(target->actionLock);
+  message = action->message;
+  }
+
+  if (message.empty())
+    {
+    return true;
+    }
+
+  // Variable paths are read straight from the frame, without compiling an expression,
+  // so a log action costs about as much as the condition check that got us here.
+  auto frame = thread.GetFrameAtIndex(0);
+
+  std::string line;
+  size_t pos = 0;
+  while (pos < message.size())
+    {
+    auto open = message.find('{', pos);
+    auto close = open == std::string::npos ? std::string::npos : message.find('}', open);
+    if (close == std::string::npos)
+      {
+      line.append(message, pos, std::string::npos);
+      break;
+      }
+
+    line.append(message, pos, open - pos);
+
+    auto path = message.substr(open + 1, close - open - 1);
+    auto value = frame.GetValueForVariablePath(path.c_str());
+    const char *str = value.IsValid() ? value.GetValue() : nullptr;
+    if (!str && value.IsValid())
+      {
+      str = value.GetSummary();
+      }
+    line += str ? str : "<unavailable>";
+
+    pos = close + 1;
+    }
+
+  line.push_back('\n');
+  target->appendLog(line);
+  return false;
+  }
 }
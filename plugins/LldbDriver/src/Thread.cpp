@@ -1,6 +1,7 @@
 #include "Thread.h"
 #include "ThreadImpl.h"
 #include "ValueImpl.h"
+#include "ProcessImpl.h"
 #include "lldb/API/SBStream.h"
 #include "Target.h"
 #include "Breakpoint.h"
@@ -58,6 +59,7 @@ Frame Thread::frameAt(size_t index)
 void Thread::selectFrame(const Frame &f)
   {
   _impl->thread.SetSelectedFrame(f.id());
+  _impl->process->_impl->snapshot = nullptr;
   }
 
 Frame Thread::selectedFrame()
@@ -3,10 +3,25 @@
 #include "FrameImpl.h"
 #include "TypeImpl.h"
 #include "Containers/XStringSimple.h"
+#include <algorithm>
+#include <cstdio>
 
 namespace LldbDriver
 {
 
+namespace
+{
+
+lldb::SBValue elementAt(const ContiguousArray &array, lldb::SBValue value, uint64_t address, size_t i)
+  {
+  char name[32];
+  snprintf(name, sizeof(name), "[%zu]", i);
+
+  return value.CreateValueFromAddress(name, address + i * array.elementSize(), array.elementType());
+  }
+
+}
+
 Value::Value()
   {
   }
@@ -79,19 +94,164 @@ Value Value::dereference() const
 
 bool Value::mightHaveChildren() const
   {
+  if (_impl->contiguousArray().isValid())
+    {
+    return childCount() != 0;
+    }
+
   return _impl->value.MightHaveChildren();
   }
 
 size_t Value::childCount() const
   {
+  auto &array = _impl->contiguousArray();
+  if (array.isValid())
+    {
+    uint64_t address = 0;
+    size_t count = 0;
+    return array.locate(_impl->value, address, count) ? count : 0;
+    }
+
   return _impl->value.GetNumChildren();
   }
 
 Value Value::childAt(size_t i) const
   {
+  auto &array = _impl->contiguousArray();
+  if (array.isValid())
+    {
+    uint64_t address = 0;
+    size_t count = 0;
+    if (!array.locate(_impl->value, address, count) || i >= count)
+      {
+      return Value();
+      }
+
+    return Value::Impl::make(elementAt(array, _impl->value, address, i));
+    }
+
   return Value::Impl::make(_impl->value.GetChildAtIndex(i, lldb::eNoDynamicValues, false));
   }
 
+Eks::Vector<Value> Value::children(size_t start, size_t count) const
+  {
+  Eks::Vector<Value> result(Eks::Core::defaultAllocator());
+
+  size_t total = childCount();
+  if (start >= total)
+    {
+    return result;
+    }
+
+  count = std::min(count, total - start);
+  result.resize(count);
+
+  for (size_t i = 0; i < count; ++i)
+    {
+    result[i] = childAt(start + i);
+    }
+
+  return result;
+  }
+
+Eks::Vector<ValueSummary> Value::summaries(size_t start, size_t count) const
+  {
+  auto &array = _impl->contiguousArray();
+  if (array.isValid())
+    {
+    return arraySummaries(array, start, count);
+    }
+
+  Eks::Vector<ValueSummary> result(Eks::Core::defaultAllocator());
+
+  size_t total = _impl->value.GetNumChildren();
+  if (start >= total)
+    {
+    return result;
+    }
+
+  count = std::min(count, total - start);
+  result.resize(count);
+
+  auto str = [](const char *s)
+    {
+    return s ? Eks::String(s) : Eks::String();
+    };
+
+  for (size_t i = 0; i < count; ++i)
+    {
+    auto child = _impl->value.GetChildAtIndex(start + i, lldb::eNoDynamicValues, false);
+
+    auto &summary = result[i];
+    summary._child = Value::Impl::make(child);
+    summary._name = str(child.GetName());
+    summary._typeName = str(child.GetTypeName());
+    summary._value = str(child.GetValue());
+    summary._mightHaveChildren = child.MightHaveChildren();
+    }
+
+  return result;
+  }
+
+Eks::Vector<ValueSummary> Value::arraySummaries(const ContiguousArray &array, size_t start, size_t count) const
+  {
+  Eks::Vector<ValueSummary> result(Eks::Core::defaultAllocator());
+
+  uint64_t address = 0;
+  size_t total = 0;
+  if (!array.locate(_impl->value, address, total) || start >= total)
+    {
+    return result;
+    }
+
+  // Read the elements in one go and format them here, lldb only makes the value returned as each child.
+  std::vector<uint8_t> bytes;
+  count = array.read(_impl->value, start, count, bytes);
+  result.resize(count);
+
+  const char *typeName = array.elementType().GetDisplayTypeName();
+  Eks::String elementTypeName = typeName ? typeName : "";
+
+  char name[32];
+  for (size_t i = 0; i < count; ++i)
+    {
+    snprintf(name, sizeof(name), "[%zu]", start + i);
+
+    auto &summary = result[i];
+    summary._child = Value::Impl::make(elementAt(array, _impl->value, address, start + i));
+    summary._name = name;
+    summary._typeName = elementTypeName;
+    summary._value = array.format(bytes.data() + i * array.elementSize());
+    summary._mightHaveChildren = false;
+    }
+
+  return result;
+  }
+
+bool Value::isContiguousArray() const
+  {
+  return _impl->contiguousArray().isValid();
+  }
+
+Value Value::asArray(size_t count) const
+  {
+  auto result = Value::Impl::make(_impl->value);
+  result._impl->arrayDetected = true;
+  result._impl->array.setPointer(_impl->value, count);
+  return result;
+  }
+
+ArrayStatistics Value::statistics() const
+  {
+  auto &array = _impl->contiguousArray();
+  if (!array.isValid())
+    {
+    return ArrayStatistics();
+    }
+
+  return array.statistics(_impl->value);
+  }
+
 Value Value::evaluate(const char *name, const char *exp) const
   {
   return Value::Impl::make(_impl->value.CreateValueFromExpression(name, exp));
@@ -102,4 +262,18 @@ Value Value::evaluateChild(const char *path) const
   return Value::Impl::make(_impl->value.GetValueForExpressionPath(path));
   }
 
+ValueSummary::ValueSummary()
+    : _mightHaveChildren(false)
+  {
+  }
+
+ArrayStatistics::ArrayStatistics()
+    : _valid(false),
+      _count(0),
+      _minimum(0.0),
+      _maximum(0.0),
+      _sum(0.0)
+  {
+  }
+
 }
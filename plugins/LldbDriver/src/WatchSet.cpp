@@ -0,0 +1,265 @@
+#include "WatchSet.h"
+#include "WatchSetImpl.h"
+#include "Type.h"
+#include <chrono>
+
+namespace LldbDriver
+{
+
+WatchSet::WatchSet()
+  {
+  }
+
+WatchSet::~WatchSet()
+  {
+  }
+
+WatchSet::Pointer WatchSet::create()
+  {
+  auto set = std::make_shared<WatchSet>();
+  auto &impl = *set->_impl;
+
+  impl.expressions = Evaluator::create();
+  impl.expressions->setPolicy(EvaluationPolicy::VariablesOnly);
+  impl.evaluator = std::thread([&impl]() { impl.run(); });
+  return set;
+  }
+
+Evaluator::Pointer WatchSet::evaluator() const
+  {
+  return _impl->expressions;
+  }
+
+size_t WatchSet::add(const char *expression)
+  {
+  std::lock_guard<std::mutex> l(_impl->lock);
+  size_t id = _impl->nextId++;
+
+  auto &watch = _impl->watches[id];
+  watch.expression = expression ? expression : "";
+  watch.result._expression = watch.expression.c_str();
+  return id;
+  }
+
+void WatchSet::remove(size_t id)
+  {
+  std::lock_guard<std::mutex> l(_impl->lock);
+  _impl->watches.erase(id);
+  }
+
+void WatchSet::setExpression(size_t id, const char *expression)
+  {
+  std::lock_guard<std::mutex> l(_impl->lock);
+  auto it = _impl->watches.find(id);
+  if (it == _impl->watches.end())
+    {
+    return;
+    }
+
+  // The old result doesn't describe the new expression, it waits for the next stop.
+  auto &watch = it->second;
+  watch.expression = expression ? expression : "";
+  watch.result = WatchResult();
+  watch.result._expression = watch.expression.c_str();
+  }
+
+Eks::Vector<size_t> WatchSet::ids() const
+  {
+  std::lock_guard<std::mutex> l(_impl->lock);
+
+  Eks::Vector<size_t> result(Eks::Core::defaultAllocator());
+  result.resize(_impl->watches.size());
+
+  size_t i = 0;
+  xForeach(const auto &watch, _impl->watches)
+    {
+    result[i++] = watch.first;
+    }
+
+  return result;
+  }
+
+Eks::String WatchSet::expression(size_t id) const
+  {
+  std::lock_guard<std::mutex> l(_impl->lock);
+  auto it = _impl->watches.find(id);
+  if (it == _impl->watches.end())
+    {
+    return Eks::String();
+    }
+
+  return it->second.expression.c_str();
+  }
+
+void WatchSet::evaluate(const Frame &frame)
+  {
+  auto released = _impl->takeReleased();
+  {
+  std::lock_guard<std::mutex> l(_impl->lock);
+  _impl->frame = std::make_shared<Frame>(frame);
+  ++_impl->generation;
+
+  xForeach(auto &watch, _impl->watches)
+    {
+    watch.second.result._stale = true;
+    }
+  }
+  _impl->wake.notify_all();
+  }
+
+void WatchSet::markStale()
+  {
+  auto released = _impl->takeReleased();
+  std::lock_guard<std::mutex> l(_impl->lock);
+
+  // Abandon the batch too, the frame it was reading has gone.
+  ++_impl->generation;
+  _impl->evaluated = _impl->generation;
+  _impl->frame.reset();
+
+  xForeach(auto &watch, _impl->watches)
+    {
+    watch.second.result._stale = true;
+    }
+  }
+
+bool WatchSet::isEvaluating() const
+  {
+  std::lock_guard<std::mutex> l(_impl->lock);
+  return _impl->evaluated != _impl->generation;
+  }
+
+WatchResult WatchSet::result(size_t id) const
+  {
+  std::lock_guard<std::mutex> l(_impl->lock);
+  auto it = _impl->watches.find(id);
+  if (it == _impl->watches.end())
+    {
+    return WatchResult();
+    }
+
+  return it->second.result;
+  }
+
+void WatchSet::setResultCallback(const std::function<void (size_t)> &fn)
+  {
+  std::lock_guard<std::mutex> l(_impl->callbackLock);
+  _impl->callback = fn;
+  }
+
+void WatchSet::releaseFrames()
+  {
+  _impl->takeReleased();
+  }
+
+void WatchSet::Impl::run()
+  {
+  std::unique_lock<std::mutex> l(lock);
+  for (;;)
+    {
+    wake.wait(l, [this]() { return quit || evaluated != generation; });
+    if (quit)
+      {
+      return;
+      }
+
+    auto batch = generation;
+    auto batchFrame = frame;
+
+    // Watches added while the batch runs are picked up by walking ids past the last one done.
+    size_t next = 0;
+    while (batchFrame && generation == batch && !quit)
+      {
+      auto it = watches.lower_bound(next);
+      if (it == watches.end())
+        {
+        break;
+        }
+
+      size_t id = it->first;
+      std::string expression = it->second.expression;
+      next = id + 1;
+
+      // Evaluating can run the target, so the set stays usable meanwhile.
+      l.unlock();
+      auto start = std::chrono::steady_clock::now();
+      auto evaluation = expressions->evaluate(*batchFrame, expression.c_str());
+      Value value = evaluation.value();
+      auto method = evaluation.method();
+      auto error = evaluation.error();
+      Eks::String valueString;
+      Eks::String typeName;
+      if (method != EvaluationMethod::Failed)
+        {
+        valueString = value.value();
+        typeName = value.type().name();
+        }
+      auto cost = (size_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+      l.lock();
+
+      it = watches.find(id);
+      if (generation != batch || it == watches.end() || it->second.expression != expression)
+        {
+        continue;
+        }
+
+      auto &result = it->second.result;
+      result._value = value;
+      result._valueString = valueString;
+      result._typeName = typeName;
+      result._error = error;
+      result._pending = false;
+      result._stale = false;
+      result._method = method;
+      result._cost = cost;
+      result._totalCost += cost;
+      ++result._evaluationCount;
+
+      l.unlock();
+      {
+      std::lock_guard<std::mutex> c(callbackLock);
+      if (callback)
+        {
+        callback(id);
+        }
+      }
+      l.lock();
+      }
+
+    if (generation == batch)
+      {
+      evaluated = batch;
+      }
+
+    // If the frame has been replaced this may be the last reference to the process, which
+    // mustn't be destroyed here, so it's handed back to be released by the owning thread.
+    if (!batchFrame || batchFrame == frame)
+      {
+      continue;
+      }
+
+    released.push_back(std::move(batchFrame));
+    l.unlock();
+    {
+    std::lock_guard<std::mutex> c(callbackLock);
+    if (callback)
+      {
+      callback(BatchFinished);
+      }
+    }
+    l.lock();
+    }
+  }
+
+WatchResult::WatchResult()
+    : _pending(true),
+      _stale(false),
+      _method(EvaluationMethod::None),
+      _cost(0),
+      _totalCost(0),
+      _evaluationCount(0)
+  {
+  }
+
+}
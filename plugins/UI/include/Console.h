@@ -1,5 +1,8 @@
 #pragma once
 #include <QPlainTextEdit>
+#include <QTextCharFormat>
+#include <QTimer>
+#include <functional>
 #include "Utilities/XNotifier.h"
 #include "Containers/XStringSimple.h"
 #include "Containers/XStringBuffer.h"
@@ -13,6 +16,35 @@ namespace UI
 /// \expose unmanaged
 X_DECLARE_NOTIFIER(InputNotifier, std::function<void (Eks::String)>);
 
+/// Splits output into runs of text and the format their ANSI escape codes select, in one pass.
+/// State is kept between calls, so a code split over two chunks of output still applies.
+class AnsiParser
+  {
+public:
+  AnsiParser();
+
+  void reset();
+
+  /// Call [insert] with each run of plain text in [str], and its format.
+  void parse(const QString &str, const std::function<void (const QString &, const QTextCharFormat &)> &insert);
+
+private:
+  enum State
+    {
+    Text,
+    Escape,
+    Control,
+    Command
+    };
+
+  void applyCodes();
+  static QColor colour(int index);
+
+  State _state;
+  QString _codes;
+  QTextCharFormat _format;
+  };
+
 class ConsoleWidget : public QPlainTextEdit
   {
   Q_OBJECT
@@ -49,6 +81,7 @@ public:
 
 public slots:
   void toEnd();
+  void flush();
   virtual void moveHorizontal(int);
   virtual void moveVertical(int);
   void deleteBack();
@@ -57,10 +90,17 @@ protected slots:
   virtual void onInput(int chr, const QString &str);
 
 private:
+  void insertText(const QString &str);
+
   ConsoleWidget *_edit;
   InputNotifier _onInput;
   QString _submit;
   int _pos;
+
+  // Output is collected here, and appended at most once a frame.
+  QString _pending;
+  QTimer _flushTimer;
+  AnsiParser _parser;
   };
 
 }
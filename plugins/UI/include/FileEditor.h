@@ -3,35 +3,47 @@
 #include "Editor.h"
 #include "Utilities/XNotifier.h"
 #include "Module.h"
+#include "SourceView.h"
 #include "QtWidgets/QPlainTextEdit"
+#include "QtGui/QTextBlock"
 #include <set>
+#include <vector>
 
 namespace UI
 {
 
-class CodeEditor : public QPlainTextEdit
+class CodeEditor : public QPlainTextEdit, public SourceDisplay
   {
   Q_OBJECT
 
 public:
   CodeEditor(QWidget *parent = 0);
 
-  QWidget *widget() { return this; }
+  QWidget *widget() X_OVERRIDE { return this; }
+
+  void setFile(const SourceFile::Pointer &file) X_OVERRIDE;
+
+  void focusOnLine(int line) X_OVERRIDE;
 
   void lineNumberAreaPaintEvent(QPaintEvent *event);
   int lineNumberAreaWidth();
 
   void marginMouseReleaseEvent(QMouseEvent *e);
 
-  void addBreakpoint(int line);
-  void removeBreakpoint(int line);
-  void clearBreakpoints();
+  void addBreakpoint(int line) X_OVERRIDE;
+  void removeBreakpoint(int line) X_OVERRIDE;
+  void clearBreakpoints() X_OVERRIDE;
+  void setBreakpoints(const Eks::Vector<size_t> &lines) X_OVERRIDE;
+
+  void addActiveLine(int line) X_OVERRIDE;
+  void removeActiveLine(int line) X_OVERRIDE;
+  void clearActiveLines() X_OVERRIDE;
+  void setActiveLines(const Eks::Vector<size_t> &lines) X_OVERRIDE;
 
-  void addActiveLine(int line);
-  void removeActiveLine(int line);
-  void clearActiveLines();
+  void setCurrentLine(int line) X_OVERRIDE;
 
-  void setCurrentLine(int line);
+  /// The block for one based [line], found through an index rebuilt only when the text changes.
+  QTextBlock blockForLine(int line);
 
 signals:
   void marginClicked(int);
@@ -43,12 +55,20 @@ private slots:
   void updateLineNumberAreaWidth(int newBlockCount);
   void highlightLines();
   void updateLineNumberArea(const QRect &, int);
+  void invalidateBlocks();
 
 private:
+  void queueHighlight();
+
   QWidget *_lineNumberArea;
   std::multiset<int> _breakpoints;
   int _currentLine;
   std::set<int> _activelines;
+
+  std::vector<QTextBlock> _blocks;
+  bool _blocksValid;
+  // Marker changes are collected, and highlighted once control returns to the event loop.
+  bool _highlightQueued;
   };
 
 class LineNumberArea : public QWidget
@@ -91,7 +111,10 @@ class FileEditor : public Editor
   Q_OBJECT
 public:
   /// \noexpose
-  FileEditor(const QString &filename);
+  FileEditor(const SourceFile::Pointer &file);
+
+  /// \noexpose
+  void setFile(const SourceFile::Pointer &file);
 
   void focusOnLine(size_t line);
 
@@ -114,14 +137,27 @@ public:
   void addMarker(MarkerType m, size_t line);
   void removeMarker(MarkerType m, size_t line);
   void clearMarkers(MarkerType m);
+  /// Replace every marker of type [m] with [lines], updating the view once.
+  void setMarkers(MarkerType m, const Eks::Vector<size_t> &lines);
 
 private slots:
   void marginClicked(int);
 
 private:
+  void createEditor(const SourceFile::Pointer &file);
+
   QString _path;
-  CodeEditor *_editor;
+  // Held so the source cache keeps the file, and its watch, while the editor is open.
+  SourceFile::Pointer _file;
+  SourceDisplay *_editor;
+  // Whether _editor is a SourceView, which large files are shown in.
+  bool _large;
   MarginClickNotifier _marginClicked;
+
+  // Markers set, to show them again if the file changes size enough to need the other display.
+  std::multiset<size_t> _breakpoints;
+  std::set<size_t> _activeLines;
+  int _currentLine;
   };
 
 }
@@ -0,0 +1,82 @@
+#pragma once
+#include "UiGlobal.h"
+#include "Dockable.h"
+#include "Process.h"
+#include "XGlobal.h"
+#include "QtWidgets/QAbstractScrollArea"
+#include <vector>
+
+class QLineEdit;
+
+namespace UI
+{
+
+/// Hex dump of a process' memory, which only reads and paints the rows on screen.
+/// Reads go through the process' page cache, and the memory either side of the
+/// view is read ahead in the background, so scrolling rarely waits on the process.
+class HexView : public QAbstractScrollArea
+  {
+  Q_OBJECT
+
+public:
+  enum
+    {
+    BytesPerRow = 16,
+    // Rows the scroll bar covers, centred on the address last asked for.
+    WindowRows = 4 * 1024 * 1024
+    };
+
+  HexView(QWidget *parent = 0);
+
+  void setProcess(const Process::Pointer &process);
+
+  /// Scroll so the row holding [address] is at the top.
+  void setAddress(uint64_t address);
+  /// The address of the first byte on screen.
+  uint64_t address() const;
+
+protected:
+  void paintEvent(QPaintEvent *event) X_OVERRIDE;
+  void resizeEvent(QResizeEvent *event) X_OVERRIDE;
+  void scrollContentsBy(int dx, int dy) X_OVERRIDE;
+
+private:
+  int rowHeight() const;
+  int visibleRows() const;
+  void updateScrollBars();
+  void readAhead(uint64_t first, size_t size);
+
+  Process::Pointer _process;
+  // Address of the scroll bar's first row.
+  uint64_t _base;
+  // The range last read ahead around, so repaints in place don't queue more reads.
+  uint64_t _readAheadAddress;
+
+  std::vector<uint8_t> _bytes;
+  std::vector<bool> _readable;
+  };
+
+/// \expose
+class HexViewDock : public Dockable
+  {
+  Q_OBJECT
+
+public:
+  /// \noexpose
+  HexViewDock(bool toolbar);
+
+  void setProcess(const Process::Pointer &process);
+  void clear();
+
+  void setAddress(uint64_t address);
+  uint64_t address() const;
+
+private slots:
+  void addressEntered();
+
+private:
+  QLineEdit *_addressEdit;
+  HexView *_view;
+  };
+
+}
@@ -2,12 +2,12 @@
 #include "UiGlobal.h"
 #include "QMainWindow"
 #include "QToolBar"
-#include "QTimer"
 #include "QPointer"
 #include "Debugger.h"
 #include "Target.h"
 #include "Process.h"
 #include "Module.h"
+#include "SymbolIndex.h"
 #include "TypeManager.h"
 #include "Utilities/XNotifier.h"
 
@@ -29,6 +29,10 @@ class ModuleExplorer;
 class ToolBar;
 class Menu;
 class Dockable;
+class ValueTreeDock;
+class HexViewDock;
+class WatchDock;
+class SourceCache;
 
 /// \expose unmanaged
 X_DECLARE_NOTIFIER(OutputNotifier, std::function<void (QString)>);
@@ -61,6 +65,9 @@ public:
   Console *addConsole(const QString &n, bool toolbar);
   EditableTextWindow *addEditor(const QString &n, bool toolbar);
   Dockable *addModuleExplorer(const QString &n, bool toolbar);
+  ValueTreeDock *addValueTree(const QString &n, bool toolbar);
+  HexViewDock *addMemoryView(const QString &n, bool toolbar);
+  WatchDock *addWatches(const QString &n, bool toolbar);
 
   ToolBar *addToolBar(const QString &n);
 
@@ -74,6 +81,9 @@ public:
   void setTarget(const Target::Pointer &tar);
   Target::Pointer target() const;
 
+  /// Functions, data and types of the current target, or null if there is none.
+  SymbolIndex::Pointer symbolIndex() const;
+
   void setProcess(const Process::Pointer &);
   Process::Pointer process() const;
 
@@ -86,12 +96,16 @@ public:
 
   DebugNotifier *debugOutput() { return &_debugOutput; }
 
+  /// \noexpose
+  SourceCache *sources() { return _sources; }
+
 public slots:
   Editor *openFile(const QString &str, int line = -1);
   Editor *openType(const QString &);
 
 private slots:
-  void typeAdded(const Module::Pointer &, const UI::CachedType::Pointer &);
+  void typesAdded(const Module::Pointer &, const UI::CachedTypeList &);
+  void typeDeclarationsAdded(const Module::Pointer &, const UI::CachedTypeList &);
   void onError(const QString &str);
   void setStatusText(const QString &str);
 
@@ -99,7 +113,8 @@ private slots:
   void openFile(const Module::Pointer &ptr, const QString &);
   void openType(const Module::Pointer &ptr, const QString &);
 
-  void timerTick();
+  void processEvents();
+  void sourceChanged(const QString &path);
 
 private:
   void checkError(const Error &err);
@@ -116,8 +131,10 @@ private:
 
   QHash<QString, Editor *> _editors;
   TypeManager *_types;
+  SourceCache *_sources;
 
   Target::Pointer _target;
+  SymbolIndex::Pointer _symbols;
 
   Process::Pointer _process;
 
@@ -129,8 +146,6 @@ private:
   DebugNotifier _debugOutput;
 
   AboutToCloseNotifier _aboutToClose;
-
-  QTimer _timer;
   };
 
 }
@@ -4,24 +4,30 @@
 #include "Module.h"
 #include "Dockable.h"
 #include "TypeManager.h"
+#include "SearchIndex.h"
 #include "QtWidgets/QTreeView"
 #include "QtCore/QSortFilterProxyModel"
-#include "QtGui/QStandardItemModel"
+#include "QtCore/QAbstractItemModel"
 #include "QtCore/QThread"
 #include <set>
-
-class QFileInfo;
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace UI
 {
 
 class ModuleWorker;
+class FilterHelper;
+class SourceCache;
 
-class ModuleExplorer : public QStandardItemModel
+/// Model of the modules in a target, their files and types.
+/// Nodes are kept in flat arrays with interned strings, and only become items when the view asks for them.
+class ModuleExplorer : public QAbstractItemModel
   {
   Q_OBJECT
 public:
-  ModuleExplorer(TypeManager *types);
+  ModuleExplorer(TypeManager *types, SourceCache *sources);
   ~ModuleExplorer();
 
   QWidget *widget() { return _widget; }
@@ -39,9 +45,19 @@ public:
     {
     Module,
     Source,
-    DataType
+    DataType,
+    Group
     };
 
+  QModelIndex index(int row, int column, const QModelIndex &parent) const X_OVERRIDE;
+  QModelIndex parent(const QModelIndex &child) const X_OVERRIDE;
+  int rowCount(const QModelIndex &parent) const X_OVERRIDE;
+  int columnCount(const QModelIndex &parent) const X_OVERRIDE;
+  QVariant data(const QModelIndex &index, int role) const X_OVERRIDE;
+
+  /// False if [index] is hidden by the current search.
+  bool isVisible(const QModelIndex &index) const;
+
 signals:
   void sourceFileActivated(const Module::Pointer &, QString file);
   void dataTypeActivated(const Module::Pointer &, QString file);
@@ -51,38 +67,83 @@ signals:
 private slots:
   void loadedFiles(const Module::Pointer &, const QStringList &str);
   void itemDoubleClicked(const QModelIndex &);
-  void typeAdded(const Module::Pointer &module, const UI::CachedType::Pointer &);
-  void typeDeclarationAdded(const Module::Pointer &module, const UI::CachedType::Pointer &, const Type *t);
+  void typesAdded(const Module::Pointer &module, const UI::CachedTypeList &types);
+  void typeDeclarationsAdded(const Module::Pointer &module, const UI::CachedTypeList &types);
   void filterChanged(const QString &filter);
+  void filterModeChanged(int mode);
+  void refreshFilter();
 
 private:
-  void clearTree();
-  void rebuildTree();
-  void buildModule(QStandardItem *module, const Module::Pointer &, bool &isSystem);
-  bool isSystemModule(const QString &path, const Module::Pointer &);
-  QString makeFileTooltip(const QString file, const QFileInfo &info);
-  void insertTypeReference(const Module::Pointer &module, QStandardItem *parent, const CachedType::Pointer &type);
+  enum
+    {
+    RootNode = 0,
+    NoNode = 0xFFFFFFFF
+    };
+
+  struct Node
+    {
+    quint32 parent;
+    quint32 row;
+    quint32 text;
+    quint32 path;
+    quint32 module;
+    ItemType type;
+    std::vector<quint32> children;
+    };
 
   struct ModuleData
     {
-    QStandardItem *moduleItem = nullptr;
-    QStandardItem *filesItem = nullptr;
-    QStandardItem *typeItem = nullptr;
-    std::unordered_map<CachedType::Pointer, QStandardItem *> items;
+    Module::Pointer module;
+    quint32 node;
+    quint32 files;
+    quint32 types;
+    std::unordered_map<CachedType::Pointer, quint32> typeNodes;
     };
 
-  QHash<QString, QStandardItem*> _fileMap;
+  void clearTree();
+  void rebuildTree();
+  bool isSystemModule(const QString &path, const Module::Pointer &);
+  QString makeFileTooltip(const QString file) const;
+
+  quint32 intern(const QString &str);
+  quint32 createNode(ItemType type, const QString &text, const QString &path, quint32 module);
+  QModelIndex indexFor(quint32 node) const;
+  void appendNode(quint32 parent, quint32 node);
+  void insertSorted(quint32 parent, std::vector<quint32> &nodes);
+  void addReferences(quint32 module, quint32 file, const CachedTypeList &types);
+
+  void updateFilter();
+  void markVisible(quint32 node);
+  void filterNodeAdded(quint32 node);
+
+  std::vector<Node> _nodes;
+  std::vector<QString> _strings;
+  QHash<QString, quint32> _stringIds;
+
+  std::vector<ModuleData> _modules;
+  std::unordered_map<Module::Pointer, quint32> _moduleIndices;
+
+  QHash<QString, quint32> _fileMap;
   QMultiMap<QString, CachedType::Pointer> _unownedTypeMap;
-  std::unordered_map<Module::Pointer, ModuleData> _moduleMap;
+  // (file node, path string) pairs already referenced, so references aren't duplicated.
+  std::unordered_set<quint64> _references;
+
+  SearchIndex _search;
+  QString _filterText;
+  SearchIndex::Mode _filterMode;
+  // Nodes matching the search, or with a descendant that does.
+  std::vector<bool> _visible;
+  bool _filterRefreshQueued;
 
   QWidget *_widget;
   QTreeView *_tree;
-  QSortFilterProxyModel *_filter;
+  FilterHelper *_filter;
   Target::Pointer _target;
 
   QThread *_workerThread;
   ModuleWorker *_worker;
   TypeManager *_types;
+  SourceCache *_sources;
   };
 
 /// \expose
@@ -90,7 +151,7 @@ class ModuleExplorerDock : public Dockable
   {
   Q_OBJECT
 public:
-  ModuleExplorerDock(TypeManager *types, bool toolbar);
+  ModuleExplorerDock(TypeManager *types, SourceCache *sources, bool toolbar);
 
   void setTarget(const Target::Pointer &ptr);
 
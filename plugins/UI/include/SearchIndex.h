@@ -0,0 +1,66 @@
+#pragma once
+#include "UiGlobal.h"
+#include "QtCore/QHash"
+#include "QtCore/QString"
+#include <vector>
+
+namespace UI
+{
+
+/// Index of names and paths for incremental searching, without rescanning everything per query.
+/// Prefix queries binary search a sorted list of names, substring and fuzzy queries
+/// intersect posting lists of trigrams or characters in the paths, then check the survivors.
+class SearchIndex
+  {
+public:
+  enum Mode
+    {
+    Prefix,
+    Substring,
+    Fuzzy
+    };
+
+  SearchIndex();
+
+  void clear();
+
+  /// Add [id], found by a prefix of [name] or by a substring or fuzzy match of [path].
+  /// Ids must be added in increasing order.
+  void add(quint32 id, const QString &name, const QString &path);
+
+  /// Find the ids matching [pattern], in increasing order.
+  std::vector<quint32> find(const QString &pattern, Mode mode) const;
+
+  /// Check a single name and path against [pattern], as find would.
+  static bool matches(const QString &name, const QString &path, const QString &pattern, Mode mode);
+
+private:
+  struct Name
+    {
+    QString text;
+    quint32 id;
+    };
+
+  static quint64 trigram(const QChar *str);
+  static bool isSubsequence(const QString &pattern, const QString &str);
+
+  void addPosting(std::vector<quint32> &list, quint32 id);
+  std::vector<quint32> intersect(std::vector<const std::vector<quint32> *> &lists) const;
+
+  std::vector<quint32> findPrefix(const QString &pattern) const;
+  std::vector<quint32> findSubstring(const QString &pattern) const;
+  std::vector<quint32> findFuzzy(const QString &pattern) const;
+
+  void mergeNames() const;
+
+  // The first _sortedNames are sorted. Names added since are sorted on their own
+  // and merged in by the next prefix query, rather than sorting everything again.
+  mutable std::vector<Name> _names;
+  mutable size_t _sortedNames;
+
+  std::vector<QString> _paths;
+  QHash<quint64, std::vector<quint32>> _trigrams;
+  QHash<ushort, std::vector<quint32>> _characters;
+  };
+
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include "UiGlobal.h"
+#include "SourceFile.h"
+#include "QtCore/QFileSystemWatcher"
+#include "QtCore/QHash"
+#include <list>
+
+namespace UI
+{
+
+/// Source files shared between editors, tooltips and anything else showing source, keyed by path.
+/// Files are kept while in use, and the least recently used of the rest are dropped past a limit.
+/// Cached files are watched, and dropped as soon as they change on disk.
+class SourceCache : public QObject
+  {
+  Q_OBJECT
+
+public:
+  SourceCache(size_t maximumUnused = 64);
+
+  /// Find [path] in the cache, or open it.
+  SourceFile::Pointer file(const QString &path);
+
+  /// When [path] was last modified, from the cache if it is loaded.
+  QDateTime lastModified(const QString &path) const;
+
+  void clear();
+
+signals:
+  /// [path] changed on disk since it was cached, open views should reload it.
+  void fileChanged(const QString &path);
+
+private slots:
+  void onFileChanged(const QString &path);
+
+private:
+  struct Entry
+    {
+    SourceFile::Pointer file;
+    std::list<QString>::iterator recent;
+    };
+
+  void trim();
+
+  size_t _maximumUnused;
+  QHash<QString, Entry> _files;
+  // Most recently used first.
+  std::list<QString> _recent;
+  QFileSystemWatcher _watcher;
+  };
+
+}
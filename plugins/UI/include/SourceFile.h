@@ -0,0 +1,84 @@
+#pragma once
+#include "UiGlobal.h"
+#include "QtCore/QDateTime"
+#include "QtCore/QFile"
+#include "QtCore/QObject"
+#include "QtCore/QString"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace UI
+{
+
+/// Read only view of a source file on disk.
+/// Large files are read on a background thread - read only ones are memory mapped, others copied
+/// a chunk at a time - and the offset of each line found as the text arrives, so opening one is
+/// constant time, and the view fills in behind it.
+class SourceFile : public QObject
+  {
+  Q_OBJECT
+
+public:
+  typedef std::shared_ptr<SourceFile> Pointer;
+
+  /// Files larger than this are read in the background, and shown without loading them into a document.
+  static const qint64 largeFileSize = 1024 * 1024;
+
+  SourceFile(const QString &path);
+  ~SourceFile();
+
+  const QString &path() const { return _path; }
+  bool isOpen() const { return _open; }
+  bool isWritable() const { return _writable; }
+  bool isLarge() const { return _size > largeFileSize; }
+  qint64 size() const { return _size; }
+  /// When the file was modified as it was opened.
+  const QDateTime &lastModified() const { return _lastModified; }
+
+  /// All of the text read so far, best kept to files that aren't large.
+  QString text() const;
+
+  /// True once every line has been read and found, lineCount is only the lines found so far until then.
+  bool isIndexed() const { return _indexed; }
+  size_t lineCount() const;
+  /// Length in bytes of the longest line found so far.
+  size_t longestLine() const { return _longestLine; }
+
+  /// The text of zero based [line], without its line ending.
+  QString line(size_t line) const;
+
+signals:
+  /// Emitted from the indexing thread as lines are found, and once more when it finishes.
+  /// Small files are indexed before the constructor returns.
+  void linesAdded();
+
+private:
+  void buildIndex();
+  quint64 available() const;
+
+  QString _path;
+  QDateTime _lastModified;
+  QFile _file;
+  // Contents of small files, read as they are opened.
+  QByteArray _buffer;
+  // Contents of large files which aren't mapped, filled in by the indexer.
+  std::unique_ptr<char[]> _copy;
+  const char *_data;
+  qint64 _size;
+  bool _open;
+  bool _writable;
+
+  mutable std::mutex _lock;
+  // Bytes of _data read so far.
+  quint64 _available;
+  std::vector<quint64> _lineStarts;
+  std::atomic<size_t> _longestLine;
+  std::atomic<bool> _indexed;
+  std::atomic<bool> _cancelled;
+  std::thread _indexer;
+  };
+
+}
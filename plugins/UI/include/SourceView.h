@@ -0,0 +1,102 @@
+#pragma once
+#include "UiGlobal.h"
+#include "SourceFile.h"
+#include "XGlobal.h"
+#include "Containers/XVector.h"
+#include "QtWidgets/QAbstractScrollArea"
+#include <set>
+
+namespace UI
+{
+
+/// Line markers shared by the widgets a FileEditor can show its file in.
+/// Lines are one based, as lldb reports them.
+class SourceDisplay
+  {
+public:
+  virtual ~SourceDisplay() { }
+
+  virtual QWidget *widget() = 0;
+
+  /// Show [file], keeping the markers on the same line numbers.
+  virtual void setFile(const SourceFile::Pointer &file) = 0;
+
+  virtual void focusOnLine(int line) = 0;
+
+  virtual void addBreakpoint(int line) = 0;
+  virtual void removeBreakpoint(int line) = 0;
+  virtual void clearBreakpoints() = 0;
+  /// Replace every breakpoint marker with [lines], in one update.
+  virtual void setBreakpoints(const Eks::Vector<size_t> &lines) = 0;
+
+  virtual void addActiveLine(int line) = 0;
+  virtual void removeActiveLine(int line) = 0;
+  virtual void clearActiveLines() = 0;
+  /// Replace every active line with [lines], in one update.
+  virtual void setActiveLines(const Eks::Vector<size_t> &lines) = 0;
+
+  virtual void setCurrentLine(int line) = 0;
+  };
+
+/// Read only view of a SourceFile, which only lays out and paints the lines on screen.
+/// Used for files too large to load into a QPlainTextEdit.
+class SourceView : public QAbstractScrollArea, public SourceDisplay
+  {
+  Q_OBJECT
+
+public:
+  SourceView(const SourceFile::Pointer &file, QWidget *parent = 0);
+
+  QWidget *widget() X_OVERRIDE { return this; }
+
+  void setFile(const SourceFile::Pointer &file) X_OVERRIDE;
+
+  void focusOnLine(int line) X_OVERRIDE;
+
+  void addBreakpoint(int line) X_OVERRIDE;
+  void removeBreakpoint(int line) X_OVERRIDE;
+  void clearBreakpoints() X_OVERRIDE;
+  void setBreakpoints(const Eks::Vector<size_t> &lines) X_OVERRIDE;
+
+  void addActiveLine(int line) X_OVERRIDE;
+  void removeActiveLine(int line) X_OVERRIDE;
+  void clearActiveLines() X_OVERRIDE;
+  void setActiveLines(const Eks::Vector<size_t> &lines) X_OVERRIDE;
+
+  void setCurrentLine(int line) X_OVERRIDE;
+
+  void marginPaintEvent(QPaintEvent *event);
+  void marginMouseReleaseEvent(QMouseEvent *event);
+  int marginWidth() const;
+
+signals:
+  void marginClicked(int);
+
+protected:
+  void paintEvent(QPaintEvent *event) X_OVERRIDE;
+  void resizeEvent(QResizeEvent *event) X_OVERRIDE;
+  void scrollContentsBy(int dx, int dy) X_OVERRIDE;
+  void changeEvent(QEvent *event) X_OVERRIDE;
+
+private slots:
+  void linesAdded();
+
+private:
+  int lineHeight() const;
+  int visibleLineCount() const;
+  void updateScrollBars();
+  void updateMargin();
+  void scrollToLine(int line);
+
+  SourceFile::Pointer _file;
+  QWidget *_margin;
+  size_t _lineCount;
+
+  std::multiset<int> _breakpoints;
+  std::set<int> _activeLines;
+  int _currentLine;
+  // A line asked for before the index reached it, scrolled to once it does.
+  int _pendingFocus;
+  };
+
+}
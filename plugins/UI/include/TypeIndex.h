@@ -0,0 +1,45 @@
+#pragma once
+#include "UiGlobal.h"
+#include "Module.h"
+#include "QtCore/QString"
+#include <vector>
+
+namespace UI
+{
+
+/// On disk cache of the types found in a module, so unchanged modules don't need their
+/// debug info walked again. Each module gets its own file, keyed on the module's path, and
+/// only trusted if the module's UUID and modification time still match.
+///
+/// The file is a header, a table of fixed size records, then a block of utf8 strings the
+/// records point into, so it can be mapped and read in place.
+class TypeIndex
+  {
+public:
+  enum
+    {
+    NoParent = 0xFFFFFFFF
+    };
+
+  struct Entry
+    {
+    QString path;
+    /// Index of the parent entry, always earlier in the list, or NoParent.
+    quint32 parent;
+    QString basename;
+    QString specialisation;
+    QString file;
+    quint32 line;
+    /// True if the module has a definition of the type, not just types nested in it.
+    bool declared;
+    };
+
+  /// Read the index for [module], returns false if there isn't one or the module has changed since it was written.
+  static bool load(const Module::Pointer &module, std::vector<Entry> &entries);
+  static bool save(const Module::Pointer &module, const std::vector<Entry> &entries);
+
+private:
+  static QString indexPath(const QString &modulePath);
+  };
+
+}
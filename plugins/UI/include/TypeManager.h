@@ -5,6 +5,14 @@
 #include "Type.h"
 #include "QtCore/QObject"
 #include "QtCore/QHash"
+#include "QtCore/QElapsedTimer"
+#include <array>
+#include <atomic>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace UI
 {
@@ -25,8 +33,17 @@ public:
   QString file;
   size_t line;
   Eks::Vector<Type, 16> definitions;
+
+  /// Modules which define this type, but which were loaded from a TypeIndex,
+  /// so their definitions haven't been looked up yet.
+  std::vector<Module::Pointer> unresolvedModules;
+
+  /// Guards the declaration data above, which any of the loading workers may add to.
+  std::mutex lock;
   };
 
+typedef std::vector<CachedType::Pointer> CachedTypeList;
+
 class TypeManager : public QObject
   {
   Q_OBJECT
@@ -37,51 +54,121 @@ public:
 
   void setTarget(const Target::Pointer &tar);
 
-  void registerType(const std::shared_ptr<CachedType> &);
+  /// Register [type], unless another worker got there first.
+  /// Returns the type now registered under [type]'s path.
+  std::shared_ptr<CachedType> registerType(const std::shared_ptr<CachedType> &type);
   std::shared_ptr<CachedType> findType(const QString &str);
 
+  /// Fill in [type]'s definitions from any modules it was loaded from an index for.
+  void resolveDefinitions(const std::shared_ptr<CachedType> &type);
+
+  /// Take the next module needing types loaded, or null if there are none left.
+  Module::Pointer nextModule();
+  bool isCancelled() const { return _cancelled; }
+
 public slots:
-  void loadedType(const Module::Pointer &module, const UI::CachedType::Pointer &cached);
-  void loadedTypeDeclaration(const Module::Pointer &module, const UI::CachedType::Pointer &cached, const Type *type);
+  void loadedTypes(int generation, const Module::Pointer &module, const UI::CachedTypeList &types);
+  void loadedTypeDeclarations(int generation, const Module::Pointer &module, const UI::CachedTypeList &types);
 
 signals:
-  void loadTypes(const Module::Pointer &ptr);
-  void typeAdded(const Module::Pointer &module, const UI::CachedType::Pointer &);
-  void typeDeclarationAdded(const Module::Pointer &module, const UI::CachedType::Pointer &, const Type *t);
+  void typesAdded(const Module::Pointer &module, const UI::CachedTypeList &);
+  void typeDeclarationsAdded(const Module::Pointer &module, const UI::CachedTypeList &);
 
 private:
+  typedef std::map<Module::Pointer, CachedTypeList> ModuleTypes;
+  typedef std::vector<std::pair<Module::Pointer, CachedType::Pointer>> WaitingTypes;
+
   void endWorker();
   void startWorker();
 
-  QThread *_workerThread;
-  std::mutex _typeLock;
-  QHash<QString, std::shared_ptr<CachedType>> _types;
+  void deliver(const Module::Pointer &module, const CachedType::Pointer &type, ModuleTypes &types, ModuleTypes &declarations);
+  void emitDelivered(const ModuleTypes &types, const ModuleTypes &declarations);
+
+  enum
+    {
+    ShardCount = 64
+    };
+
+  struct Shard
+    {
+    std::mutex lock;
+    QHash<QString, std::shared_ptr<CachedType>> types;
+    };
+
+  Shard &shardFor(const QString &path);
+
+  std::vector<QThread *> _workerThreads;
+  std::mutex _queueLock;
+  std::deque<Module::Pointer> _queue;
+  std::atomic<bool> _cancelled;
+
+  std::array<Shard, ShardCount> _shards;
   Target::Pointer _target;
+
+  // Bumped by setTarget. Workers tag their batches with it, so batches an old
+  // target's workers queued before they were joined can be dropped.
+  int _generation;
+
+  // Each worker sends its batches in order, but batches from different workers interleave.
+  // Types whose parent hasn't been sent on yet, and declarations of types that haven't,
+  // wait here for it, so listeners always see a type before its children and declarations.
+  std::unordered_set<CachedType::Pointer> _delivered;
+  std::unordered_map<CachedType::Pointer, WaitingTypes> _waitingChildren;
+  std::unordered_map<CachedType::Pointer, WaitingTypes> _waitingDeclarations;
   };
 
 class TypeManagerWorker : public QObject
   {
   Q_OBJECT
 public:
-  TypeManagerWorker(TypeManager *mgr);
+  TypeManagerWorker(TypeManager *mgr, int generation);
 
 public slots:
+  void run();
   void loadTypes(const Module::Pointer &ptr);
   void loadType(const Module::Pointer &ptr, const Type &t);
 
 signals:
-  void loadedType(const Module::Pointer &, const UI::CachedType::Pointer &type);
-  void loadedTypeDeclaration(const Module::Pointer &, const UI::CachedType::Pointer &type, const Type *);
+  void loadedTypes(int generation, const Module::Pointer &, const UI::CachedTypeList &types);
+  void loadedTypeDeclarations(int generation, const Module::Pointer &, const UI::CachedTypeList &types);
 
 private:
+  enum
+    {
+    // A batch is handed to the gui thread when it holds this many types,
+    // or has been collecting for this many milliseconds, whichever is first.
+    // The age is checked as types arrive and after each compile unit.
+    BatchSize = 256,
+    BatchInterval = 50
+    };
+
+  void typeLoaded(const Module::Pointer &module, const std::shared_ptr<CachedType> &type);
+  void declarationLoaded(const Module::Pointer &module, const std::shared_ptr<CachedType> &type);
+  void startBatch();
+  void flushIfDue(const Module::Pointer &module);
+  void flush(const Module::Pointer &module);
+
+  bool loadIndex(const Module::Pointer &module);
+  void saveIndex(const Module::Pointer &module);
+
   std::shared_ptr<CachedType> findOrCreateType(const Module::Pointer &module, const QString &qstr, const Eks::String &str);
   std::shared_ptr<CachedType> createType(const Module::Pointer &module, const QString &qstr, const Eks::String &str, const Type *t);
   void addDeclaration(const Module::Pointer &module, const std::shared_ptr<CachedType> &type, const Type *t);
   TypeManager *_manager;
+  int _generation;
+
+  // Types declared by the module being loaded, written to its index when it finishes.
+  std::vector<std::shared_ptr<CachedType>> _moduleTypes;
+  std::unordered_set<CachedType *> _moduleDeclarations;
+
+  CachedTypeList _loadedTypes;
+  CachedTypeList _loadedDeclarations;
+  QElapsedTimer _batchAge;
   };
 
 }
 
 Q_DECLARE_METATYPE(Type*);
 Q_DECLARE_METATYPE(UI::CachedType::Pointer);
+Q_DECLARE_METATYPE(UI::CachedTypeList);
 
@@ -0,0 +1,89 @@
+#pragma once
+#include "UiGlobal.h"
+#include "Dockable.h"
+#include "Frame.h"
+#include "FrameValues.h"
+#include "Value.h"
+#include "QtCore/QAbstractItemModel"
+#include <memory>
+#include <vector>
+
+class QTreeView;
+
+namespace UI
+{
+
+/// Model over the values in a frame. Children are only requested from the debugger
+/// when a node is expanded, and only a page at a time, so large containers cost
+/// nothing until they are scrolled through. Stopping again in the same frame keeps
+/// the rows, and only those whose values changed are redrawn, and highlighted.
+class ValueTreeModel : public QAbstractItemModel
+  {
+  Q_OBJECT
+
+public:
+  ValueTreeModel(QObject *parent);
+  ~ValueTreeModel();
+
+  enum Column
+    {
+    NameColumn,
+    ValueColumn,
+    TypeColumn,
+
+    ColumnCount
+    };
+
+  enum
+    {
+    // Children fetched per expand or scroll to the end of a node.
+    PageSize = 128
+    };
+
+  void setFrame(const Frame &frame);
+  void clear();
+
+  QModelIndex index(int row, int column, const QModelIndex &parent) const X_OVERRIDE;
+  QModelIndex parent(const QModelIndex &child) const X_OVERRIDE;
+  int rowCount(const QModelIndex &parent) const X_OVERRIDE;
+  int columnCount(const QModelIndex &parent) const X_OVERRIDE;
+  bool hasChildren(const QModelIndex &parent) const X_OVERRIDE;
+  QVariant data(const QModelIndex &index, int role) const X_OVERRIDE;
+  QVariant headerData(int section, Qt::Orientation orientation, int role) const X_OVERRIDE;
+
+  bool canFetchMore(const QModelIndex &parent) const X_OVERRIDE;
+  void fetchMore(const QModelIndex &parent) X_OVERRIDE;
+
+private:
+  struct Node;
+  Node *nodeFor(const QModelIndex &index) const;
+  void rebuild();
+  void refresh(Node *node, const QModelIndex &index, bool changed);
+  void refreshElements(Node *node);
+
+  std::unique_ptr<Node> _root;
+  FrameValues::Pointer _values;
+  // Highlighted since the last stop, cleared on the next.
+  std::vector<Node *> _changed;
+  };
+
+/// \expose
+class ValueTreeDock : public Dockable
+  {
+  Q_OBJECT
+
+public:
+  /// \noexpose
+  ValueTreeDock(bool toolbar);
+
+  void setFrame(const Frame &frame);
+  void clear();
+  /// Grey out the values while the process runs, they are kept to compare against at the next stop.
+  void setRunning(bool running);
+
+private:
+  QTreeView *_tree;
+  ValueTreeModel *_model;
+  };
+
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include "UiGlobal.h"
+#include "Dockable.h"
+#include "WatchSet.h"
+#include "Frame.h"
+#include "QtCore/QHash"
+#include <memory>
+
+class QLineEdit;
+class QTreeWidget;
+class QTreeWidgetItem;
+
+namespace UI
+{
+
+/// List of watch expressions, evaluated together each time the process stops.
+/// The WatchSet evaluates them on its own thread and each row is filled in as its
+/// result arrives, so a long list doesn't hold up the stop. Rows still showing a
+/// result from an earlier stop are greyed until they are replaced. Only variable paths
+/// are evaluated unless expressions that may run the target are turned on from the menu.
+/// \expose
+class WatchDock : public Dockable
+  {
+  Q_OBJECT
+
+public:
+  enum Column
+    {
+    ExpressionColumn,
+    ValueColumn,
+    TypeColumn,
+    CostColumn,
+
+    ColumnCount
+    };
+
+  /// \noexpose
+  WatchDock(bool toolbar);
+  ~WatchDock();
+
+  void addWatch(const QString &expression);
+  /// Remove every watch, when another project's are about to be loaded.
+  void clearWatches();
+  size_t watchCount() const;
+  QString watchExpression(size_t i) const;
+
+  /// Evaluate every watch in [frame], replacing results as they arrive.
+  void evaluate(const Frame &frame);
+  /// Grey out the results while the process runs, they are kept until the next stop replaces them.
+  void setRunning(bool running);
+  /// Forget the frame when the process ends, leaving the expressions and their last results greyed.
+  void clear();
+
+private slots:
+  void expressionEntered();
+  void removeSelected();
+  void itemChanged(QTreeWidgetItem *item, int column);
+  void resultReady(quint64 id);
+  void setRunTarget(bool run);
+
+private:
+  QTreeWidgetItem *addItem(size_t id, const QString &expression);
+  void update(QTreeWidgetItem *item, size_t id);
+
+  WatchSet::Pointer _watches;
+  // The frame last evaluated in, so watches added while stopped are evaluated straight away.
+  std::unique_ptr<Frame> _frame;
+
+  QLineEdit *_expressionEdit;
+  QTreeWidget *_tree;
+  QHash<quint64, QTreeWidgetItem *> _items;
+  // Set while rows are filled in, so the edits aren't taken as the user renaming a watch.
+  bool _updating;
+  };
+
+}
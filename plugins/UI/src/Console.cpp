@@ -1,10 +1,231 @@
 #include "Console.h"
 #include "QPlainTextEdit"
+#include "QScrollBar"
 #include "QVBoxLayout"
 
 namespace UI
 {
 
+namespace
+{
+
+// Lines of scrollback kept, older lines are dropped as new ones arrive.
+const int scrollbackLines = 10000;
+// Output waiting beyond this is older than anything the scrollback could show.
+const int maximumPending = scrollbackLines * 256;
+const int flushInterval = 16;
+
+}
+
+AnsiParser::AnsiParser()
+  {
+  reset();
+  }
+
+void AnsiParser::reset()
+  {
+  _state = Text;
+  _codes.clear();
+  _format = QTextCharFormat();
+  }
+
+void AnsiParser::parse(const QString &str, const std::function<void (const QString &, const QTextCharFormat &)> &insert)
+  {
+  const QChar *data = str.constData();
+  const int size = str.size();
+
+  int runStart = 0;
+  auto endRun = [&](int end)
+    {
+    if (end > runStart)
+      {
+      insert(QString::fromRawData(data + runStart, end - runStart), _format);
+      }
+    };
+
+  for (int i = 0; i < size; ++i)
+    {
+    const ushort c = data[i].unicode();
+    switch (_state)
+      {
+    case Text:
+      if (c == 27)
+        {
+        endRun(i);
+        _state = Escape;
+        }
+      break;
+
+    case Escape:
+      if (c == '[')
+        {
+        _codes.clear();
+        _state = Control;
+        }
+      else if (c == ']')
+        {
+        _state = Command;
+        }
+      else
+        {
+        // Two character sequences, nothing here to show.
+        _state = Text;
+        runStart = i + 1;
+        }
+      break;
+
+    case Control:
+      if (c >= 0x40 && c <= 0x7E)
+        {
+        // Only graphics codes change anything in a console, cursor movement is dropped.
+        if (c == 'm')
+          {
+          applyCodes();
+          }
+        _state = Text;
+        runStart = i + 1;
+        }
+      else
+        {
+        _codes.append(data[i]);
+        }
+      break;
+
+    case Command:
+      // Window titles and the like, ended by a bell or string terminator.
+      if (c == 7 || c == '\\')
+        {
+        _state = Text;
+        runStart = i + 1;
+        }
+      break;
+      }
+    }
+
+  if (_state == Text)
+    {
+    endRun(size);
+    }
+  }
+
+void AnsiParser::applyCodes()
+  {
+  auto codes = _codes.splitRef(QLatin1Char(';'));
+  for (int i = 0; i < codes.size(); ++i)
+    {
+    int code = codes[i].toInt();
+    if (code == 0)
+      {
+      _format = QTextCharFormat();
+      }
+    else if (code == 1)
+      {
+      _format.setFontWeight(QFont::Bold);
+      }
+    else if (code == 22)
+      {
+      _format.setFontWeight(QFont::Normal);
+      }
+    else if (code == 4)
+      {
+      _format.setFontUnderline(true);
+      }
+    else if (code == 24)
+      {
+      _format.setFontUnderline(false);
+      }
+    else if (code >= 30 && code <= 37)
+      {
+      _format.setForeground(colour(code - 30));
+      }
+    else if (code >= 90 && code <= 97)
+      {
+      _format.setForeground(colour(code - 90 + 8));
+      }
+    else if (code >= 40 && code <= 47)
+      {
+      _format.setBackground(colour(code - 40));
+      }
+    else if (code >= 100 && code <= 107)
+      {
+      _format.setBackground(colour(code - 100 + 8));
+      }
+    else if (code == 39)
+      {
+      _format.clearForeground();
+      }
+    else if (code == 49)
+      {
+      _format.clearBackground();
+      }
+    else if ((code == 38 || code == 48) && i + 1 < codes.size())
+      {
+      // Extended colours, either 5;index or 2;r;g;b.
+      QColor col;
+      int mode = codes[i + 1].toInt();
+      if (mode == 5 && i + 2 < codes.size())
+        {
+        col = colour(codes[i + 2].toInt());
+        i += 2;
+        }
+      else if (mode == 2 && i + 4 < codes.size())
+        {
+        col = QColor(codes[i + 2].toInt(), codes[i + 3].toInt(), codes[i + 4].toInt());
+        i += 4;
+        }
+      else
+        {
+        ++i;
+        continue;
+        }
+
+      if (code == 38)
+        {
+        _format.setForeground(col);
+        }
+      else
+        {
+        _format.setBackground(col);
+        }
+      }
+    }
+  }
+
+QColor AnsiParser::colour(int index)
+  {
+  static const QRgb basic[] =
+    {
+    0x000000, 0xAA0000, 0x00AA00, 0xAA5500, 0x0000AA, 0xAA00AA, 0x00AAAA, 0xAAAAAA,
+    0x555555, 0xFF5555, 0x55FF55, 0xFFFF55, 0x5555FF, 0xFF55FF, 0x55FFFF, 0xFFFFFF
+    };
+
+  if (index < 0)
+    {
+    return QColor();
+    }
+
+  if (index < 16)
+    {
+    return QColor(basic[index]);
+    }
+
+  if (index < 232)
+    {
+    // 6x6x6 colour cube.
+    index -= 16;
+    auto level = [](int v) { return v ? 55 + v * 40 : 0; };
+    return QColor(level(index / 36), level((index / 6) % 6), level(index % 6));
+    }
+
+  if (index < 256)
+    {
+    int grey = 8 + (index - 232) * 10;
+    return QColor(grey, grey, grey);
+    }
+
+  return QColor();
+  }
+
 ConsoleWidget::ConsoleWidget(QWidget *w) : QPlainTextEdit(w)
   {
   }
@@ -58,6 +279,12 @@ Console:: Console(bool toolbar)
   QFont font("Courier New");
   font.setStyleHint(QFont::Monospace);
   _edit->setFont(font);
+  _edit->setUndoRedoEnabled(false);
+  _edit->setMaximumBlockCount(scrollbackLines);
+
+  _flushTimer.setSingleShot(true);
+  _flushTimer.setInterval(flushInterval);
+  connect(&_flushTimer, SIGNAL(timeout()), this, SLOT(flush()));
 
   connect(_edit, SIGNAL(keyPress(int, QString)), this, SLOT(onInput(int, QString)));
   connect(_edit, SIGNAL(deleteBack()), this, SLOT(deleteBack()));
@@ -71,42 +298,67 @@ Console::~Console()
 
 void Console::append(QString str)
   {
-  // Scrub out any colour codes...
-  bool erasing = false;
-  for(int i = 0; i < str.size(); ++i)
+  _pending.append(str);
+
+  if (_pending.size() > maximumPending)
     {
-    bool erase = false;
-    QChar c = str[i];
-    if (c == 27)
-      {
-      erasing = true;
-      erase = true;
-      }
-    else if (erasing && c == 'm')
-      {
-      erasing = false;
-      erase = true;
-      }
-    else if(erasing)
-      {
-      erase = true;
-      }
+    // Drop whole lines from the front, they would be scrolled out as soon as they were added.
+    int cut = _pending.indexOf(QLatin1Char('\n'), _pending.size() - maximumPending);
+    _pending.remove(0, cut == -1 ? _pending.size() - maximumPending : cut + 1);
+    }
 
-    if (erase)
-      {
-      str.remove(i, 1);
-      --i;
-      }
+  if (!_flushTimer.isActive())
+    {
+    _flushTimer.start();
     }
+  }
 
-  _edit->insertPlainText(str);
+void Console::flush()
+  {
+  _flushTimer.stop();
+  if (_pending.isEmpty())
+    {
+    return;
+    }
+
+  auto scrollBar = _edit->verticalScrollBar();
+  int scrolled = scrollBar->value();
+  bool atBottom = scrolled == scrollBar->maximum();
+
+  QTextCursor cursor(_edit->document());
+  cursor.movePosition(QTextCursor::End);
+  cursor.beginEditBlock();
+  _parser.parse(_pending, [&cursor](const QString &text, const QTextCharFormat &format)
+    {
+    cursor.insertText(text, format);
+    });
+  cursor.endEditBlock();
+  _pending.clear();
 
+  toEnd();
+  // The edit's cursor picks up the format of the text before it, which shouldn't colour what the user types.
+  _edit->setCurrentCharFormat(QTextCharFormat());
+  if (!atBottom)
+    {
+    // Leave the view where it was if the user scrolled up to read something.
+    scrollBar->setValue(scrolled);
+    }
+  }
+
+void Console::insertText(const QString &str)
+  {
+  flush();
+  toEnd();
+  _edit->setCurrentCharFormat(QTextCharFormat());
+  _edit->insertPlainText(str);
   toEnd();
   }
 
 void Console::clear()
   {
   clearSubmit();
+  _pending.clear();
+  _parser.reset();
   _edit->clear();
   }
 
@@ -115,7 +367,7 @@ void Console::setSubmit(const QString &str)
   clearSubmit();
   _submit = str;
   _pos = _submit.length();
-  append(str);
+  insertText(str);
   }
 
 void Console::clearSubmit()
@@ -24,7 +24,8 @@ public:
   GenericTextWrapper(T *t, ChangedNotifier *n)
       : _t(t)
     {
-    QObject::connect(t, &T::editingFinished, [n, this]()
+    // Notify as the user types, so dialogs can filter incrementally.
+    QObject::connect(t, &T::textEdited, [n, this]()
       {
       (*n)(_t->objectName());
       });
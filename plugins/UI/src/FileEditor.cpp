@@ -1,7 +1,7 @@
   #include "FileEditor.h"
-#include "QFile"
 #include "QFileInfo"
 #include "QPainter"
+#include "QScrollBar"
 #include "QTextBlock"
 #include "QVBoxLayout"
 
@@ -10,16 +10,45 @@ namespace UI
 
 CodeEditor::CodeEditor(QWidget *parent)
     : QPlainTextEdit(parent),
-      _currentLine(-1)
+      _currentLine(-1),
+      _blocksValid(false),
+      _highlightQueued(false)
   {
   _lineNumberArea = new LineNumberArea(this);
 
   connect(this, SIGNAL(blockCountChanged(int)), this, SLOT(updateLineNumberAreaWidth(int)));
   connect(this, SIGNAL(updateRequest(QRect,int)), this, SLOT(updateLineNumberArea(QRect,int)));
+  connect(this, SIGNAL(textChanged()), this, SLOT(invalidateBlocks()));
 
   updateLineNumberAreaWidth(0);
   }
 
+void CodeEditor::setFile(const SourceFile::Pointer &file)
+  {
+  // Reloading would throw away unsaved edits and their undo history, so keep them instead.
+  if (!isReadOnly() && document()->isModified())
+    {
+    return;
+    }
+
+  int line = textCursor().blockNumber() + 1;
+  int scroll = verticalScrollBar()->value();
+
+  setPlainText(file->text());
+
+  // Leave the cursor and view where they were, as far as the new text allows.
+  setTextCursor(QTextCursor(blockForLine(std::min(line, blockCount()))));
+  verticalScrollBar()->setValue(scroll);
+  queueHighlight();
+  }
+
+void CodeEditor::focusOnLine(int line)
+  {
+  QTextCursor cursor(blockForLine(line));
+  cursor.select(QTextCursor::LineUnderCursor);
+  setTextCursor(cursor);
+  }
+
 int CodeEditor::lineNumberAreaWidth()
   {
   int digits = 1;
@@ -63,10 +92,20 @@ void CodeEditor::clearBreakpoints()
   _lineNumberArea->update();
   }
 
+void CodeEditor::setBreakpoints(const Eks::Vector<size_t> &lines)
+  {
+  _breakpoints.clear();
+  xForeach(auto line, lines)
+    {
+    _breakpoints.insert((int)line);
+    }
+  _lineNumberArea->update();
+  }
+
 void CodeEditor::addActiveLine(int line)
   {
   _activelines.insert(line);
-  highlightLines();
+  queueHighlight();
   }
 
 void CodeEditor::removeActiveLine(int line)
@@ -75,22 +114,68 @@ void CodeEditor::removeActiveLine(int line)
   if (it != _activelines.end())
     {
     _activelines.erase(it);
-    highlightLines();
+    queueHighlight();
     }
   }
 
 void CodeEditor::clearActiveLines()
   {
-  _activelines.clear(); 
+  _activelines.clear();
+  queueHighlight();
+  }
+
+void CodeEditor::setActiveLines(const Eks::Vector<size_t> &lines)
+  {
+  _activelines.clear();
+  xForeach(auto line, lines)
+    {
+    _activelines.insert((int)line);
+    }
+  queueHighlight();
   }
 
 void CodeEditor::setCurrentLine(int line)
   {
   _currentLine = line;
-  highlightLines();
+  queueHighlight();
   _lineNumberArea->update();
   }
 
+QTextBlock CodeEditor::blockForLine(int line)
+  {
+  if (!_blocksValid)
+    {
+    _blocks.clear();
+    _blocks.reserve(document()->blockCount());
+    for (auto block = document()->begin(); block.isValid(); block = block.next())
+      {
+      _blocks.push_back(block);
+      }
+    _blocksValid = true;
+    }
+
+  if (line < 1 || line > (int)_blocks.size())
+    {
+    return QTextBlock();
+    }
+
+  return _blocks[line - 1];
+  }
+
+void CodeEditor::invalidateBlocks()
+  {
+  _blocksValid = false;
+  }
+
+void CodeEditor::queueHighlight()
+  {
+  if (!_highlightQueued)
+    {
+    _highlightQueued = true;
+    QMetaObject::invokeMethod(this, "highlightLines", Qt::QueuedConnection);
+    }
+  }
+
 void CodeEditor::updateLineNumberAreaWidth(int)
   {
   setViewportMargins(lineNumberAreaWidth(), 0, 0, 0);
@@ -123,15 +208,24 @@ void CodeEditor::resizeEvent(QResizeEvent *e)
 
 void CodeEditor::highlightLines()
   {
+  _highlightQueued = false;
+
   QList<QTextEdit::ExtraSelection> extraSelections;
+  extraSelections.reserve((int)_activelines.size() + 1);
 
   auto highlightLine = [&](auto line, const auto &col)
     {
+    auto block = blockForLine(line);
+    if (!block.isValid())
+      {
+      return;
+      }
+
     QTextEdit::ExtraSelection selection;
 
     selection.format.setBackground(col);
     selection.format.setProperty(QTextFormat::FullWidthSelection, true);
-    selection.cursor = QTextCursor(document()->findBlockByLineNumber(line-1));
+    selection.cursor = QTextCursor(block);
     selection.cursor.clearSelection();
     extraSelections.append(selection);
     };
@@ -202,37 +296,91 @@ void CodeEditor::lineNumberAreaPaintEvent(QPaintEvent *event)
     }
   }
 
-FileEditor::FileEditor(const QString &path)
-    : _path(path)
+FileEditor::FileEditor(const SourceFile::Pointer &file)
+    : _path(file->path()),
+      _file(file),
+      _editor(nullptr),
+      _large(false),
+      _currentLine(-1)
   {
   auto layout = new QVBoxLayout(this);
   layout->setContentsMargins(0, 0, 0, 0);
-  _editor = new CodeEditor(this);
-  layout->addWidget(_editor);
 
   QFont font("Courier New");
   font.setStyleHint(QFont::Monospace);
   setFont(font);
 
-  QFile f(path);
-  if (f.open(QFile::ReadOnly))
+  createEditor(file);
+  }
+
+void FileEditor::createEditor(const SourceFile::Pointer &file)
+  {
+  _large = file->isLarge();
+  if (_large)
+    {
+    _editor = new SourceView(file, this);
+    }
+  else
+    {
+    auto editor = new CodeEditor(this);
+    _editor = editor;
+
+    editor->setFile(file);
+    if (!file->isWritable())
+      {
+      editor->setReadOnly(true);
+      }
+    }
+
+  layout()->addWidget(_editor->widget());
+  connect(_editor->widget(), SIGNAL(marginClicked(int)), this, SLOT(marginClicked(int)));
+  }
+
+void FileEditor::setFile(const SourceFile::Pointer &file)
+  {
+  if (file->isLarge() == _large)
+    {
+    _file = file;
+    _editor->setFile(file);
+    return;
+    }
+
+  // Keep unsaved edits rather than swapping them out, as CodeEditor does for a reload.
+  if (!_large)
     {
-    _editor->setPlainText(f.readAll());
+    auto editor = static_cast<CodeEditor *>(_editor);
+    if (!editor->isReadOnly() && editor->document()->isModified())
+      {
+      return;
+      }
     }
 
-  if (!QFileInfo(f).isWritable())
+  _file = file;
+
+  // The file has grown past, or shrunk under, the size shown without a document.
+  delete _editor->widget();
+  createEditor(file);
+
+  Eks::Vector<size_t> breakpoints(Eks::Core::defaultAllocator());
+  xForeach(auto line, _breakpoints)
     {
-    _editor->setReadOnly(true);
+    breakpoints << line;
     }
+  _editor->setBreakpoints(breakpoints);
 
-  connect(_editor, SIGNAL(marginClicked(int)), this, SLOT(marginClicked(int)));
+  Eks::Vector<size_t> activeLines(Eks::Core::defaultAllocator());
+  xForeach(auto line, _activeLines)
+    {
+    activeLines << line;
+    }
+  _editor->setActiveLines(activeLines);
+
+  _editor->setCurrentLine(_currentLine);
   }
 
 void FileEditor::focusOnLine(size_t line)
   {
-  QTextCursor cursor(_editor->document()->findBlockByLineNumber(line - 1));
-  cursor.select(QTextCursor::LineUnderCursor);
-  _editor->setTextCursor(cursor);
+  _editor->focusOnLine((int)line);
   }
 
 QString FileEditor::makeKey(const QString &filename)
@@ -260,14 +408,17 @@ void FileEditor::addMarker(MarkerType m, size_t line)
   {
   if (m == Breakpoint)
     {
+    _breakpoints.insert(line);
     _editor->addBreakpoint(line);
     }
   else if (m == ActiveLine)
     {
+    _activeLines.insert(line);
     _editor->addActiveLine(line);
     }
   else if (m == CurrentLine)
     {
+    _currentLine = (int)line;
     _editor->setCurrentLine(line);
     }
   }
@@ -276,14 +427,21 @@ void FileEditor::removeMarker(MarkerType m, size_t line)
   {
   if (m == Breakpoint)
     {
+    auto it = _breakpoints.find(line);
+    if (it != _breakpoints.end())
+      {
+      _breakpoints.erase(it);
+      }
     _editor->removeBreakpoint(line);
     }
   else if (m == ActiveLine)
     {
+    _activeLines.erase(line);
     _editor->removeActiveLine(line);
     }
   else if (m == CurrentLine)
     {
+    _currentLine = -1;
     _editor->setCurrentLine(-1);
     }
   }
@@ -292,18 +450,42 @@ void FileEditor::clearMarkers(MarkerType m)
   {
   if (m == Breakpoint)
     {
+    _breakpoints.clear();
     _editor->clearBreakpoints();
     }
   else if (m == ActiveLine)
     {
+    _activeLines.clear();
     _editor->clearActiveLines();
     }
   else if (m == CurrentLine)
     {
+    _currentLine = -1;
     _editor->setCurrentLine(-1);
     }
   }
 
+void FileEditor::setMarkers(MarkerType m, const Eks::Vector<size_t> &lines)
+  {
+  if (m == Breakpoint)
+    {
+    _breakpoints.clear();
+    _breakpoints.insert(lines.begin(), lines.end());
+    _editor->setBreakpoints(lines);
+    }
+  else if (m == ActiveLine)
+    {
+    _activeLines.clear();
+    _activeLines.insert(lines.begin(), lines.end());
+    _editor->setActiveLines(lines);
+    }
+  else if (m == CurrentLine)
+    {
+    _currentLine = lines.size() ? (int)lines[lines.size() - 1] : -1;
+    _editor->setCurrentLine(_currentLine);
+    }
+  }
+
 void FileEditor::marginClicked(int i)
   {
   _marginClicked(i);
@@ -0,0 +1,268 @@
+#include "HexView.h"
+#include "QtGui/QPainter"
+#include "QtGui/QPaintEvent"
+#include "QtWidgets/QLineEdit"
+#include "QtWidgets/QScrollBar"
+#include "QtWidgets/QVBoxLayout"
+#include <algorithm>
+
+namespace UI
+{
+
+namespace
+{
+
+const int textMargin = 4;
+// Address, gap, three characters per byte, a gap at the middle and before the text, then the text.
+const int rowCharacters = 16 + 2 + HexView::BytesPerRow * 3 + 2 + HexView::BytesPerRow;
+
+// Reads are split on page boundaries, so an unreadable page doesn't hide the ones after it.
+const uint64_t pageSize = 4096;
+// Read ahead either side of the view, as much as the cache reads in one go.
+const size_t readAheadSize = 64 * 1024;
+
+const char hexDigits[] = "0123456789abcdef";
+
+}
+
+HexView::HexView(QWidget *parent)
+    : QAbstractScrollArea(parent),
+      _base(0),
+      _readAheadAddress(~(uint64_t)0)
+  {
+  QFont font("Courier New");
+  font.setStyleHint(QFont::Monospace);
+  setFont(font);
+
+  updateScrollBars();
+  }
+
+void HexView::setProcess(const Process::Pointer &process)
+  {
+  _process = process;
+  _readAheadAddress = ~(uint64_t)0;
+  viewport()->update();
+  }
+
+void HexView::setAddress(uint64_t address)
+  {
+  const uint64_t row = address / BytesPerRow;
+  const uint64_t lastRow = ~(uint64_t)0 / BytesPerRow;
+
+  uint64_t firstRow = row > WindowRows / 2 ? row - WindowRows / 2 : 0;
+  firstRow = std::min(firstRow, lastRow - WindowRows + 1);
+  _base = firstRow * BytesPerRow;
+
+  updateScrollBars();
+  verticalScrollBar()->setValue((int)(row - firstRow));
+  viewport()->update();
+  }
+
+uint64_t HexView::address() const
+  {
+  return _base + (uint64_t)verticalScrollBar()->value() * BytesPerRow;
+  }
+
+void HexView::paintEvent(QPaintEvent *event)
+  {
+  QPainter painter(viewport());
+  painter.fillRect(event->rect(), palette().base());
+
+  if (!_process)
+    {
+    return;
+    }
+
+  const int height = rowHeight();
+  const int ascent = fontMetrics().ascent();
+  const int x = textMargin - horizontalScrollBar()->value();
+  const int rows = visibleRows();
+  const uint64_t first = address();
+  const size_t size = (size_t)rows * BytesPerRow;
+
+  // Read everything on screen up front, the cache turns it into a few reads of whole pages.
+  _bytes.resize(size);
+  _readable.assign(size, false);
+  for (size_t offset = 0; offset < size;)
+    {
+    const uint64_t at = first + offset;
+    const size_t count = (size_t)std::min<uint64_t>(size - offset, pageSize - at % pageSize);
+
+    const size_t read = _process->readMemory(at, _bytes.data() + offset, count);
+    std::fill(_readable.begin() + offset, _readable.begin() + offset + read, true);
+    offset += count;
+    }
+
+  QString line;
+  line.reserve(rowCharacters);
+
+  painter.setPen(palette().text().color());
+  for (int i = 0; i < rows; ++i)
+    {
+    const int top = i * height;
+    if (top > event->rect().bottom())
+      {
+      break;
+      }
+
+    const size_t offset = (size_t)i * BytesPerRow;
+    line = QString::number(first + offset, 16).rightJustified(16, QLatin1Char('0'));
+    line.append(QLatin1String("  "));
+
+    for (size_t b = 0; b < BytesPerRow; ++b)
+      {
+      if (_readable[offset + b])
+        {
+        const uint8_t byte = _bytes[offset + b];
+        line.append(QLatin1Char(hexDigits[byte >> 4]));
+        line.append(QLatin1Char(hexDigits[byte & 0xf]));
+        }
+      else
+        {
+        line.append(QLatin1String("??"));
+        }
+
+      line.append(QLatin1Char(' '));
+      if (b == BytesPerRow / 2 - 1)
+        {
+        line.append(QLatin1Char(' '));
+        }
+      }
+
+    line.append(QLatin1Char(' '));
+    for (size_t b = 0; b < BytesPerRow; ++b)
+      {
+      const uint8_t byte = _bytes[offset + b];
+      if (!_readable[offset + b])
+        {
+        line.append(QLatin1Char(' '));
+        }
+      else if (byte >= 0x20 && byte < 0x7f)
+        {
+        line.append(QLatin1Char((char)byte));
+        }
+      else
+        {
+        line.append(QLatin1Char('.'));
+        }
+      }
+
+    painter.drawText(x, top + ascent, line);
+    }
+
+  readAhead(first, size);
+  }
+
+void HexView::resizeEvent(QResizeEvent *event)
+  {
+  QAbstractScrollArea::resizeEvent(event);
+  updateScrollBars();
+  }
+
+void HexView::scrollContentsBy(int, int dy)
+  {
+  // Near either end of the window, move it along so scrolling can carry on.
+  const int value = verticalScrollBar()->value();
+  const int page = verticalScrollBar()->pageStep();
+  if (dy && ((value < page && _base > 0) || value > verticalScrollBar()->maximum() - page))
+    {
+    setAddress(address());
+    return;
+    }
+
+  viewport()->update();
+  }
+
+int HexView::rowHeight() const
+  {
+  return std::max(1, fontMetrics().height());
+  }
+
+int HexView::visibleRows() const
+  {
+  return viewport()->height() / rowHeight() + 1;
+  }
+
+void HexView::updateScrollBars()
+  {
+  int page = std::max(1, viewport()->height() / rowHeight());
+  verticalScrollBar()->setRange(0, WindowRows - page);
+  verticalScrollBar()->setPageStep(page);
+  verticalScrollBar()->setSingleStep(1);
+
+  int charWidth = fontMetrics().width(QLatin1Char('9'));
+  int contentWidth = rowCharacters * charWidth + textMargin * 2;
+  horizontalScrollBar()->setRange(0, std::max(0, contentWidth - viewport()->width()));
+  horizontalScrollBar()->setPageStep(viewport()->width());
+  horizontalScrollBar()->setSingleStep(charWidth);
+  }
+
+void HexView::readAhead(uint64_t first, size_t size)
+  {
+  // Small scrolls stay within what was read ahead last time.
+  const uint64_t distance = first > _readAheadAddress ? first - _readAheadAddress : _readAheadAddress - first;
+  if (distance < readAheadSize / 2)
+    {
+    return;
+    }
+
+  _readAheadAddress = first;
+  _process->readMemoryAsync(first + size, readAheadSize, readAheadSize, Process::MemoryChunkCallback());
+  if (first > 0)
+    {
+    const uint64_t before = first > readAheadSize ? first - readAheadSize : 0;
+    _process->readMemoryAsync(before, (size_t)(first - before), readAheadSize, Process::MemoryChunkCallback());
+    }
+  }
+
+HexViewDock::HexViewDock(bool toolbar)
+    : Dockable(toolbar)
+  {
+  _addressEdit = new QLineEdit();
+  _addressEdit->setPlaceholderText(tr("Address"));
+  connect(_addressEdit, SIGNAL(returnPressed()), this, SLOT(addressEntered()));
+
+  _view = new HexView();
+
+  auto widget = new QWidget();
+  auto layout = new QVBoxLayout(widget);
+  layout->setContentsMargins(0, 0, 0, 0);
+  layout->setSpacing(0);
+  layout->addWidget(_addressEdit);
+  layout->addWidget(_view);
+
+  setWidget(widget);
+  }
+
+void HexViewDock::setProcess(const Process::Pointer &process)
+  {
+  _view->setProcess(process);
+  }
+
+void HexViewDock::clear()
+  {
+  _view->setProcess(nullptr);
+  }
+
+void HexViewDock::setAddress(uint64_t address)
+  {
+  _addressEdit->setText(QString("0x%1").arg(address, 0, 16));
+  _view->setAddress(address);
+  }
+
+uint64_t HexViewDock::address() const
+  {
+  return _view->address();
+  }
+
+void HexViewDock::addressEntered()
+  {
+  bool ok = false;
+  uint64_t address = _addressEdit->text().trimmed().toULongLong(&ok, 0);
+  if (ok)
+    {
+    _view->setAddress(address);
+    }
+  }
+
+}
@@ -7,11 +7,15 @@
 #include "QFileDialog"
 #include "QDockWidget"
 #include "FileEditor.h"
+#include "SourceCache.h"
 #include "TypeEditor.h"
 #include "Terminal.h"
 #include "ToolBar.h"
 #include "Menu.h"
 #include "EditableTextWindow.h"
+#include "ValueTree.h"
+#include "HexView.h"
+#include "WatchView.h"
 #include <array>
 
 namespace UI
@@ -31,16 +35,20 @@ MainWindow::MainWindow(QWidget *parent) :
   qRegisterMetaType<Module::Pointer>();
 
   _types = new TypeManager();
-  connect(_types, SIGNAL(typeAdded(Module::Pointer,UI::CachedType::Pointer)), this, SLOT(typeAdded(Module::Pointer,UI::CachedType::Pointer)));
+  connect(_types, SIGNAL(typesAdded(Module::Pointer,UI::CachedTypeList)), this, SLOT(typesAdded(Module::Pointer,UI::CachedTypeList)));
+  connect(_types, SIGNAL(typeDeclarationsAdded(Module::Pointer,UI::CachedTypeList)), this, SLOT(typeDeclarationsAdded(Module::Pointer,UI::CachedTypeList)));
 
-  connect(&_timer, SIGNAL(timeout()), this, SLOT(timerTick()));
-  _timer.start(100);
+  _sources = new SourceCache();
+  connect(_sources, SIGNAL(fileChanged(QString)), this, SLOT(sourceChanged(QString)));
 
   _oldHandler = qInstallMessageHandler(log);
   }
 
 MainWindow::~MainWindow()
   {
+  setProcess(nullptr);
+
+  delete _sources;
   delete ui;
   auto x = qInstallMessageHandler(_oldHandler);
   (void)x;
@@ -109,7 +117,7 @@ EditableTextWindow *MainWindow::addEditor(const QString &name, bool toolbar)
 
 Dockable *MainWindow::addModuleExplorer(const QString &n, bool toolbar)
   {
-  auto dock = new ModuleExplorerDock(_types, toolbar);
+  auto dock = new ModuleExplorerDock(_types, _sources, toolbar);
   dock->setObjectName(n);
   dock->setWindowTitle(n);
 
@@ -121,6 +129,36 @@ Dockable *MainWindow::addModuleExplorer(const QString &n, bool toolbar)
   return dock;
   }
 
+ValueTreeDock *MainWindow::addValueTree(const QString &n, bool toolbar)
+  {
+  auto dock = new ValueTreeDock(toolbar);
+  dock->setObjectName(n);
+  dock->setWindowTitle(n);
+  addDockWidget(Qt::LeftDockWidgetArea, dock);
+
+  return dock;
+  }
+
+HexViewDock *MainWindow::addMemoryView(const QString &n, bool toolbar)
+  {
+  auto dock = new HexViewDock(toolbar);
+  dock->setObjectName(n);
+  dock->setWindowTitle(n);
+  addDockWidget(Qt::LeftDockWidgetArea, dock);
+
+  return dock;
+  }
+
+WatchDock *MainWindow::addWatches(const QString &n, bool toolbar)
+  {
+  auto dock = new WatchDock(toolbar);
+  dock->setObjectName(n);
+  dock->setWindowTitle(n);
+  addDockWidget(Qt::LeftDockWidgetArea, dock);
+
+  return dock;
+  }
+
 ToolBar *MainWindow::addToolBar(const QString &n)
   {
   auto toolbar = new ToolBar;
@@ -179,6 +217,7 @@ Process::Pointer MainWindow::process() const
 void MainWindow::setTarget(const Target::Pointer &tar)
   {
   _types->setTarget(tar);
+  _symbols = tar ? SymbolIndex::create(tar) : nullptr;
 
   ui->tabWidget->clear();
   _editors.clear();
@@ -186,14 +225,60 @@ void MainWindow::setTarget(const Target::Pointer &tar)
   _target = tar;
   }
 
+SymbolIndex::Pointer MainWindow::symbolIndex() const
+  {
+  return _symbols;
+  }
+
 void MainWindow::setProcess(const Process::Pointer &ptr)
   {
+  if (_process)
+    {
+    _process->setEventsAvailableCallback(nullptr);
+    }
+
   _process = ptr;
+
+  if (_process)
+    {
+    // Called on the process listener thread, hop back to the gui thread to deliver.
+    _process->setEventsAvailableCallback([this]()
+      {
+      QMetaObject::invokeMethod(this, "processEvents", Qt::QueuedConnection);
+      });
+
+    // Pick up anything queued before the callback was installed.
+    QMetaObject::invokeMethod(this, "processEvents", Qt::QueuedConnection);
+    }
   }
 
-void MainWindow::typeAdded(const Module::Pointer &, const UI::CachedType::Pointer &type)
+void MainWindow::typesAdded(const Module::Pointer &, const UI::CachedTypeList &types)
   {
-  _typeAdded(type->path);
+  xForeach(const auto &type, types)
+    {
+    _typeAdded(type->path);
+    }
+  }
+
+void MainWindow::typeDeclarationsAdded(const Module::Pointer &module, const UI::CachedTypeList &types)
+  {
+  if (!_symbols)
+    {
+    return;
+    }
+
+  xForeach(const auto &type, types)
+    {
+    QByteArray file;
+    size_t line;
+    {
+    std::lock_guard<std::mutex> lock(type->lock);
+    file = type->file.toUtf8();
+    line = type->line;
+    }
+
+    _symbols->addType(module, type->path.toUtf8().data(), file.data(), line);
+    }
   }
 
 void MainWindow::onError(const QString &str)
@@ -228,7 +313,7 @@ Editor *MainWindow::openFile(const QString &file, int line)
     return editor;
     }
 
-  auto editor = new FileEditor(file);
+  auto editor = new FileEditor(_sources->file(file));
   addEditor(editor);
 
   if (line != -1)
@@ -239,6 +324,14 @@ Editor *MainWindow::openFile(const QString &file, int line)
   return editor;
   }
 
+void MainWindow::sourceChanged(const QString &path)
+  {
+  if (auto editor = qobject_cast<FileEditor *>(_editors.value(FileEditor::makeKey(path), nullptr)))
+    {
+    editor->setFile(_sources->file(path));
+    }
+  }
+
 void MainWindow::openFile(const Module::Pointer &, const QString &file)
   {
   openFile(file);
@@ -275,18 +368,23 @@ Editor *MainWindow::openType(const QString &type)
   }
 
 
-void MainWindow::timerTick()
+void MainWindow::processEvents()
   {
-  if (!_process)
+  // process may end during delivery, keep it alive until we are done.
+  auto process = _process;
+  if (!process)
     {
     return;
     }
 
-  _process->processEvents();
-        // process may end during the above call
-  if (!_process)
+  process->processEvents();
+
+  // Breakpoints resolved as libraries load are reported to the target, not the process.
+  // The process listener wakes us for those too, so they are delivered as they happen.
+  auto target = _target;
+  if (target)
     {
-    return;
+    target->processEvents();
     }
   }
 
@@ -2,13 +2,17 @@
 #include "Module.h"
 #include "CompileUnit.h"
 #include "Type.h"
+#include "SourceCache.h"
 #include "QtCore/QFileInfo"
 #include "QtCore/QDateTime"
 #include "QtWidgets/QHeaderView"
 #include "QtWidgets/QTreeWidgetItem"
 #include "QtWidgets/QLineEdit"
 #include "QtWidgets/QVBoxLayout"
+#include "QtWidgets/QHBoxLayout"
+#include "QtWidgets/QComboBox"
 #include "QDebug"
+#include <algorithm>
 
 namespace UI
 {
@@ -16,50 +20,20 @@ namespace UI
 class FilterHelper : public QSortFilterProxyModel
   {
 public:
-  FilterHelper(QObject *parent) : QSortFilterProxyModel(parent) { }
+  FilterHelper(ModuleExplorer *explorer) : QSortFilterProxyModel(explorer), _explorer(explorer) { }
 
-  bool filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const X_OVERRIDE
+  void refresh()
     {
-    if (filterRegExp().isEmpty())
-      {
-      return true;
-      }
-
-    auto result = QSortFilterProxyModel::filterAcceptsRow(sourceRow, sourceParent);
-
-    return result || hasAcceptedChildren(sourceRow, sourceParent);
+    invalidateFilter();
     }
 
-  bool hasAcceptedChildren(int sourceRow, const QModelIndex &sourceParent) const
+  bool filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const X_OVERRIDE
     {
-    QModelIndex item = sourceModel()->index(sourceRow, 0, sourceParent);
-    if (!item.isValid())
-      {
-      return false;
-      }
-
-    //check if there are children
-    int childCount = item.model()->rowCount(item);
-    if (childCount == 0)
-      {
-      return false;
-      }
-
-    for (int i = 0; i < childCount; ++i)
-      {
-      if (QSortFilterProxyModel::filterAcceptsRow(i, item))
-        {
-        return true;
-        }
-
-      if (hasAcceptedChildren(i, item))
-        {
-        return true;
-        }
-      }
-
-    return false;
+    return _explorer->isVisible(_explorer->index(sourceRow, 0, sourceParent));
     }
+
+private:
+  ModuleExplorer *_explorer;
   };
 
 void ModuleWorker::loadFiles(const Module::Pointer &ptr)
@@ -77,8 +51,11 @@ void ModuleWorker::loadFiles(const Module::Pointer &ptr)
   emit loadedFiles(ptr, result);
   }
 
-ModuleExplorer::ModuleExplorer(TypeManager *types)
-    : _types(types)
+ModuleExplorer::ModuleExplorer(TypeManager *types, SourceCache *sources)
+    : _filterMode(SearchIndex::Prefix),
+      _filterRefreshQueued(false),
+      _types(types),
+      _sources(sources)
   {
   qRegisterMetaType<Module::Pointer>();
 
@@ -88,18 +65,29 @@ ModuleExplorer::ModuleExplorer(TypeManager *types)
   layout->setContentsMargins(4, 4, 4, 4);
   layout->setSpacing(4);
 
+  auto searchLayout = new QHBoxLayout();
+  searchLayout->setSpacing(4);
+  layout->addLayout(searchLayout);
+
   auto edit = new QLineEdit(_widget);
   edit->setPlaceholderText("Search");
-  layout->addWidget(edit);
+  searchLayout->addWidget(edit);
   connect(edit, SIGNAL(textChanged(QString)), this, SLOT(filterChanged(QString)));
 
+  auto mode = new QComboBox(_widget);
+  mode->addItem("Prefix", SearchIndex::Prefix);
+  mode->addItem("Substring", SearchIndex::Substring);
+  mode->addItem("Fuzzy", SearchIndex::Fuzzy);
+  searchLayout->addWidget(mode);
+  connect(mode, SIGNAL(currentIndexChanged(int)), this, SLOT(filterModeChanged(int)));
+
   _tree = new QTreeView(_widget);
   layout->addWidget(_tree);
   _tree->setEditTriggers(QAbstractItemView::NoEditTriggers);
+  _tree->setUniformRowHeights(true);
   _tree->header()->hide();
 
   _filter = new FilterHelper(this);
-  _filter->setFilterKeyColumn(0);
   _tree->setModel(_filter);
   _filter->setSourceModel(this);
 
@@ -113,8 +101,8 @@ ModuleExplorer::ModuleExplorer(TypeManager *types)
 
   connect(_tree, SIGNAL(doubleClicked(QModelIndex)), this, SLOT(itemDoubleClicked(QModelIndex)));
 
-  connect(types, SIGNAL(typeAdded(Module::Pointer, UI::CachedType::Pointer)), this, SLOT(typeAdded(Module::Pointer, UI::CachedType::Pointer)));
-  connect(types, SIGNAL(typeDeclarationAdded(Module::Pointer, UI::CachedType::Pointer, const Type*)), this, SLOT(typeDeclarationAdded(Module::Pointer, UI::CachedType::Pointer, const Type*)));
+  connect(types, SIGNAL(typesAdded(Module::Pointer, UI::CachedTypeList)), this, SLOT(typesAdded(Module::Pointer, UI::CachedTypeList)));
+  connect(types, SIGNAL(typeDeclarationsAdded(Module::Pointer, UI::CachedTypeList)), this, SLOT(typeDeclarationsAdded(Module::Pointer, UI::CachedTypeList)));
   }
 
 ModuleExplorer::~ModuleExplorer()
@@ -133,6 +121,186 @@ void ModuleExplorer::setTarget(const Target::Pointer &tar)
   rebuildTree();
   }
 
+QModelIndex ModuleExplorer::index(int row, int column, const QModelIndex &parent) const
+  {
+  if (!hasIndex(row, column, parent))
+    {
+    return QModelIndex();
+    }
+
+  quint32 node = parent.isValid() ? (quint32)parent.internalId() : (quint32)RootNode;
+  return createIndex(row, column, (quintptr)_nodes[node].children[row]);
+  }
+
+QModelIndex ModuleExplorer::parent(const QModelIndex &child) const
+  {
+  if (!child.isValid())
+    {
+    return QModelIndex();
+    }
+
+  return indexFor(_nodes[child.internalId()].parent);
+  }
+
+int ModuleExplorer::rowCount(const QModelIndex &parent) const
+  {
+  if (parent.column() > 0 || _nodes.empty())
+    {
+    return 0;
+    }
+
+  quint32 node = parent.isValid() ? (quint32)parent.internalId() : (quint32)RootNode;
+  return (int)_nodes[node].children.size();
+  }
+
+int ModuleExplorer::columnCount(const QModelIndex &) const
+  {
+  return 1;
+  }
+
+QVariant ModuleExplorer::data(const QModelIndex &index, int role) const
+  {
+  if (!index.isValid())
+    {
+    return QVariant();
+    }
+
+  const auto &node = _nodes[index.internalId()];
+  switch (role)
+    {
+  case Qt::DisplayRole:
+    return _strings[node.text];
+  case Qt::ToolTipRole:
+    if (node.type == Module || node.type == Source)
+      {
+      const auto &path = _strings[node.path];
+      return makeFileTooltip(path);
+      }
+    else if (node.type == DataType)
+      {
+      return _strings[node.path];
+      }
+    break;
+  case TypeRole:
+    if (node.type != Group)
+      {
+      return node.type;
+      }
+    break;
+  case PathRole:
+    if (node.type != Group)
+      {
+      return _strings[node.path];
+      }
+    break;
+  case ModuleRole:
+    if (node.type == Source || node.type == DataType)
+      {
+      return QVariant::fromValue(_modules[node.module].module);
+      }
+    break;
+    }
+
+  return QVariant();
+  }
+
+quint32 ModuleExplorer::intern(const QString &str)
+  {
+  auto it = _stringIds.find(str);
+  if (it != _stringIds.end())
+    {
+    return it.value();
+    }
+
+  quint32 id = (quint32)_strings.size();
+  _strings.push_back(str);
+  _stringIds.insert(str, id);
+  return id;
+  }
+
+quint32 ModuleExplorer::createNode(ItemType type, const QString &text, const QString &path, quint32 module)
+  {
+  Node node;
+  node.parent = NoNode;
+  node.row = 0;
+  node.text = intern(text);
+  node.path = intern(path);
+  node.module = module;
+  node.type = type;
+
+  quint32 id = (quint32)_nodes.size();
+  _nodes.push_back(std::move(node));
+
+  if (type != Group)
+    {
+    _search.add(id, text, type == DataType ? path : text);
+    }
+  return id;
+  }
+
+QModelIndex ModuleExplorer::indexFor(quint32 node) const
+  {
+  if (node == RootNode || node == NoNode)
+    {
+    return QModelIndex();
+    }
+
+  return createIndex((int)_nodes[node].row, 0, (quintptr)node);
+  }
+
+void ModuleExplorer::appendNode(quint32 parent, quint32 node)
+  {
+  auto row = (quint32)_nodes[parent].children.size();
+
+  beginInsertRows(indexFor(parent), row, row);
+  _nodes[parent].children.push_back(node);
+  _nodes[node].parent = parent;
+  _nodes[node].row = row;
+  filterNodeAdded(node);
+  endInsertRows();
+  }
+
+void ModuleExplorer::insertSorted(quint32 parent, std::vector<quint32> &nodes)
+  {
+  auto lessThan = [this](quint32 a, quint32 b)
+    {
+    return _strings[_nodes[a].text] < _strings[_nodes[b].text];
+    };
+
+  std::sort(nodes.begin(), nodes.end(), lessThan);
+
+  // Walk the sorted nodes, inserting each run that lands between the same two
+  // existing children as one block.
+  auto &children = _nodes[parent].children;
+  size_t i = 0;
+  while (i < nodes.size())
+    {
+    size_t pos = std::upper_bound(children.begin(), children.end(), nodes[i], lessThan) - children.begin();
+
+    size_t j = i + 1;
+    while (j < nodes.size() && (pos == children.size() || lessThan(nodes[j], children[pos])))
+      {
+      ++j;
+      }
+
+    beginInsertRows(indexFor(parent), (int)pos, (int)(pos + (j - i) - 1));
+    children.insert(children.begin() + pos, nodes.begin() + i, nodes.begin() + j);
+    for (size_t row = pos; row < children.size(); ++row)
+      {
+      auto &child = _nodes[children[row]];
+      child.parent = parent;
+      child.row = (quint32)row;
+      }
+    for (size_t n = i; n < j; ++n)
+      {
+      filterNodeAdded(nodes[n]);
+      }
+    endInsertRows();
+
+    i = j;
+    }
+  }
+
 bool ModuleExplorer::isSystemModule(const QString &path, const Module::Pointer &)
   {
 #ifdef X_OSX
@@ -142,9 +310,9 @@ bool ModuleExplorer::isSystemModule(const QString &path, const Module::Pointer &
 #endif
   }
 
-QString ModuleExplorer::makeFileTooltip(const QString file, const QFileInfo &info)
+QString ModuleExplorer::makeFileTooltip(const QString file) const
   {
-  auto lastModified = info.lastModified();
+  auto lastModified = _sources->lastModified(file);
   QDateTime now = QDateTime::currentDateTime();
 
   QString type = "secs";
@@ -184,41 +352,40 @@ void ModuleExplorer::loadedFiles(const Module::Pointer &module, const QStringLis
     return;
     }
 
-  auto foundModule = _moduleMap.find(module);
-  if (foundModule == _moduleMap.end())
+  auto foundModule = _moduleIndices.find(module);
+  if (foundModule == _moduleIndices.end())
     {
     return;
     }
 
-  auto &moduleData = foundModule->second;
+  auto moduleIndex = foundModule->second;
 
-  moduleData.filesItem = new QStandardItem("Files");
-  moduleData.moduleItem->appendRow(moduleData.filesItem);
+  auto filesNode = createNode(Group, "Files", QString(), moduleIndex);
+  _modules[moduleIndex].files = filesNode;
+  appendNode(_modules[moduleIndex].node, filesNode);
 
+  std::vector<quint32> fileNodes;
+  fileNodes.reserve(files.size());
   xForeach(auto file, files)
     {
     QFileInfo info(file);
-    auto fileItem = new QStandardItem(info.fileName());
-    fileItem->setData(file, PathRole);
-    fileItem->setData(Source, TypeRole);
-    fileItem->setData(QVariant::fromValue(module), ModuleRole);
+    auto fileNode = createNode(Source, info.fileName(), file, moduleIndex);
+    fileNodes.push_back(fileNode);
 
-    fileItem->setToolTip(makeFileTooltip(file, info));
-
-    moduleData.filesItem->appendRow(fileItem);
+    _fileMap[file] = fileNode;
+    }
 
-    _fileMap[file] = fileItem;
+  insertSorted(filesNode, fileNodes);
 
-    auto beg = _unownedTypeMap.lowerBound(file);
-    auto end = _unownedTypeMap.upperBound(file);
-    for (; beg != end; ++beg)
+  xForeach(auto file, files)
+    {
+    auto unowned = _unownedTypeMap.values(file);
+    if (!unowned.isEmpty())
       {
-      insertTypeReference(module, fileItem, beg.value());
+      addReferences(moduleIndex, _fileMap.value(file), CachedTypeList(unowned.begin(), unowned.end()));
+      _unownedTypeMap.remove(file);
       }
-    _unownedTypeMap.remove(file);
     }
-
-  moduleData.filesItem->sortChildren(0);
   }
 
 void ModuleExplorer::itemDoubleClicked(const QModelIndex &index)
@@ -234,153 +401,278 @@ void ModuleExplorer::itemDoubleClicked(const QModelIndex &index)
     }
   }
 
-void ModuleExplorer::typeAdded(const Module::Pointer &module, const CachedType::Pointer &type)
+void ModuleExplorer::typesAdded(const Module::Pointer &module, const CachedTypeList &types)
   {
-  auto &item = _moduleMap[module];
-  if (!item.moduleItem)
+  auto foundModule = _moduleIndices.find(module);
+  if (foundModule == _moduleIndices.end())
     {
     // Possibly we could hit this if target changed rapidly.. probably not good.
     return;
     }
 
-  if (!item.typeItem)
-    {	
-    item.typeItem = new QStandardItem("Types");
-    item.moduleItem->appendRow(item.typeItem);
-    }
+  auto moduleIndex = foundModule->second;
+  auto &data = _modules[moduleIndex];
 
-  auto parent = item.typeItem;
-  auto it = item.items.find(type->parent);
-  if (it != item.items.end())
+  if (!data.types)
     {
-    parent = it->second;
+    data.types = createNode(Group, "Types", QString(), moduleIndex);
+    appendNode(data.node, data.types);
     }
 
-  auto typeItem = new QStandardItem(type->basename + type->specialisation);
-  parent->appendRow(typeItem);
-  typeItem->setData(type->path, PathRole);
-  typeItem->setData(DataType, TypeRole);
-  typeItem->setData(QVariant::fromValue(module), ModuleRole);
-  item.items[type] = typeItem;
+  // Gather the new nodes for each parent, so each parent gets one sorted insert per batch.
+  // Parents are always seen before their children, so inserting the groups in the order
+  // they were first seen never inserts under a node that isn't in the tree yet.
+  std::vector<std::pair<quint32, std::vector<quint32>>> groups;
+  std::unordered_map<quint32, size_t> groupIndices;
+  xForeach(const auto &type, types)
+    {
+    auto parent = data.types;
+    auto it = data.typeNodes.find(type->parent);
+    if (it != data.typeNodes.end())
+      {
+      parent = it->second;
+      }
 
-  typeItem->setToolTip(type->path);
+    auto node = createNode(DataType, type->basename + type->specialisation, type->path, moduleIndex);
+    data.typeNodes[type] = node;
 
-  parent->sortChildren(0);
+    auto group = groupIndices.find(parent);
+    if (group == groupIndices.end())
+      {
+      group = groupIndices.emplace(parent, groups.size()).first;
+      groups.emplace_back(parent, std::vector<quint32>());
+      }
+    groups[group->second].second.push_back(node);
+    }
+
+  xForeach(auto &group, groups)
+    {
+    insertSorted(group.first, group.second);
+    }
   }
 
-void ModuleExplorer::typeDeclarationAdded(const Module::Pointer &module, const CachedType::Pointer &type, const Type *)
+void ModuleExplorer::typeDeclarationsAdded(const Module::Pointer &module, const CachedTypeList &types)
   {
-  auto &moduleItem = _moduleMap[module];
-  if (!moduleItem.moduleItem)
+  auto foundModule = _moduleIndices.find(module);
+  if (foundModule == _moduleIndices.end())
     {
     // Possibly we could hit this if target changed rapidly.. probably not good.
     return;
     }
 
-  auto item = _fileMap[type->file];
-  if (item)
+  std::unordered_map<quint32, CachedTypeList> fileTypes;
+  xForeach(const auto &type, types)
     {
-    insertTypeReference(module, item, type);
-    return;
+    auto file = _fileMap.value(type->file, NoNode);
+    if (file == NoNode)
+      {
+      _unownedTypeMap.insert(type->file, type);
+      continue;
+      }
+
+    fileTypes[file].push_back(type);
     }
 
-  _unownedTypeMap.insert(type->file, type);
+  xForeach(const auto &file, fileTypes)
+    {
+    addReferences(foundModule->second, file.first, file.second);
+    }
   }
 
-void ModuleExplorer::insertTypeReference(const Module::Pointer &module, QStandardItem *parent, const CachedType::Pointer &type)
+void ModuleExplorer::addReferences(quint32 module, quint32 file, const CachedTypeList &types)
   {
-  for (int i = 0; i < parent->rowCount(); ++i)
+  std::vector<quint32> nodes;
+  xForeach(const auto &type, types)
     {
-    QStandardItem *child = parent->child(i);
-    if (child->data(PathRole).toString() == type->path)
+    quint64 key = ((quint64)file << 32) | intern(type->path);
+    if (!_references.insert(key).second)
       {
-      return;
+      continue;
       }
-    }
 
-  auto typeItem = new QStandardItem(type->basename + type->specialisation);
-  typeItem->setData(DataType, TypeRole);
-  typeItem->setData(type->path, PathRole);
-  typeItem->setData(QVariant::fromValue(module), ModuleRole);
+    nodes.push_back(createNode(DataType, type->basename + type->specialisation, type->path, module));
+    }
 
-  parent->appendRow(typeItem);
+  insertSorted(file, nodes);
   }
 
 void ModuleExplorer::filterChanged(const QString &filter)
   {
-  Qt::CaseSensitivity caseSensitivity = Qt::CaseInsensitive;
-  QString strPattern = "^" + filter;
-  QRegExp regExp(strPattern, caseSensitivity);
+  _filterText = filter;
+  updateFilter();
+  }
+
+void ModuleExplorer::filterModeChanged(int mode)
+  {
+  auto combo = qobject_cast<QComboBox *>(sender());
+  _filterMode = (SearchIndex::Mode)combo->itemData(mode).toInt();
+  updateFilter();
+  }
+
+bool ModuleExplorer::isVisible(const QModelIndex &index) const
+  {
+  if (_filterText.isEmpty() || !index.isValid())
+    {
+    return true;
+    }
+
+  auto node = index.internalId();
+  return node < _visible.size() && _visible[node];
+  }
+
+void ModuleExplorer::updateFilter()
+  {
+  _visible.clear();
+  if (!_filterText.isEmpty())
+    {
+    _visible.resize(_nodes.size(), false);
+    auto found = _search.find(_filterText, _filterMode);
+    xForeach(auto node, found)
+      {
+      markVisible(node);
+      }
+    }
 
-  _filter->setFilterRegExp(regExp);
+  _filter->refresh();
+  }
+
+void ModuleExplorer::markVisible(quint32 node)
+  {
+  for (; node != NoNode && node != RootNode; node = _nodes[node].parent)
+    {
+    if (node >= _visible.size())
+      {
+      _visible.resize(_nodes.size(), false);
+      }
+
+    if (_visible[node])
+      {
+      break;
+      }
+    _visible[node] = true;
+    }
+  }
+
+void ModuleExplorer::filterNodeAdded(quint32 node)
+  {
+  if (_filterText.isEmpty())
+    {
+    return;
+    }
+
+  const auto &data = _nodes[node];
+  if (data.type == Group)
+    {
+    return;
+    }
+
+  const auto &name = _strings[data.text];
+  const auto &path = data.type == DataType ? _strings[data.path] : name;
+  if (!SearchIndex::matches(name, path, _filterText, _filterMode))
+    {
+    return;
+    }
+
+  auto parent = data.parent;
+  bool parentVisible = parent == RootNode || (parent < _visible.size() && _visible[parent]);
+  markVisible(node);
+
+  // The proxy only checks the new row, so if its ancestors just became visible it needs to look again.
+  if (!parentVisible && !_filterRefreshQueued)
+    {
+    _filterRefreshQueued = true;
+    QMetaObject::invokeMethod(this, "refreshFilter", Qt::QueuedConnection);
+    }
+  }
+
+void ModuleExplorer::refreshFilter()
+  {
+  _filterRefreshQueued = false;
+  _filter->refresh();
   }
 
 void ModuleExplorer::clearTree()
   {
   _fileMap.clear();
   _unownedTypeMap.clear();
-  _moduleMap.clear();
-  QStandardItemModel::clear();
+  _references.clear();
+  _search.clear();
+  _visible.clear();
+  _moduleIndices.clear();
+  _modules.clear();
+  _nodes.clear();
+  _strings.clear();
+  _stringIds.clear();
   }
 
 void ModuleExplorer::rebuildTree()
   {
+  beginResetModel();
   clearTree();
+
+  _nodes.push_back(Node{ NoNode, 0, intern(QString()), intern(QString()), 0, Group, { } });
   if (!_target)
     {
+    endResetModel();
     return;
     }
 
-  QStandardItem *systemItems = new QStandardItem("System");
+  // Nothing is watching yet, so link nodes directly rather than through appendNode.
+  auto attach = [this](quint32 parent, quint32 node)
+    {
+    _nodes[node].parent = parent;
+    _nodes[node].row = (quint32)_nodes[parent].children.size();
+    _nodes[parent].children.push_back(node);
+    };
 
+  std::vector<quint32> systemModules;
   for(size_t i = 0; i < _target->moduleCount(); ++i)
     {
     auto module = _target->moduleAt(i);
 
-    bool isSystem = false;
-    auto item = new QStandardItem;
-    buildModule(item, module, isSystem);
+    QString path = module->path().data();
+    QFileInfo info(path);
 
-    if (isSystem)
+    auto moduleIndex = (quint32)_modules.size();
+    auto node = createNode(Module, info.fileName(), path, moduleIndex);
+    _modules.push_back(ModuleData{ module, node, 0, 0, { } });
+    _moduleIndices[module] = moduleIndex;
+
+    if (isSystemModule(path, module))
       {
-      systemItems->appendRow(QList<QStandardItem*>() << item);
+      systemModules.push_back(node);
       }
     else
       {
-      appendRow(item);
+      attach(RootNode, node);
       }
-
-    _moduleMap[module] = { item, nullptr, nullptr, { } };
     }
 
-  if (systemItems->hasChildren())
+  if (!systemModules.empty())
     {
-    appendRow(QList<QStandardItem*>() << systemItems);
+    auto systemNode = createNode(Group, "System", QString(), 0);
+    attach(RootNode, systemNode);
+    xForeach(auto node, systemModules)
+      {
+      attach(systemNode, node);
+      }
     }
-  }
 
-void ModuleExplorer::buildModule(QStandardItem *item, const Module::Pointer &module, bool &isSystem)
-  {
-  QString path = module->path().data();
-  QFileInfo info(path);
+  endResetModel();
 
-  item->setData(Module, TypeRole);
-  item->setData(path, PathRole);
+  // The modules were linked without going through the filter, so match the search against them now.
+  updateFilter();
 
-  QString name(info.fileName());
-  item->setText(name);
-
-  item->setToolTip(makeFileTooltip(path, info));
-
-  isSystem = isSystemModule(path, module);
-
-  emit loadFiles(module);
+  xForeach(const auto &module, _modules)
+    {
+    emit loadFiles(module.module);
+    }
   }
 
-ModuleExplorerDock::ModuleExplorerDock(TypeManager *types, bool toolbar)
+ModuleExplorerDock::ModuleExplorerDock(TypeManager *types, SourceCache *sources, bool toolbar)
     : Dockable(toolbar)
   {
-  _explorer = new ModuleExplorer(types);
+  _explorer = new ModuleExplorer(types, sources);
   setWidget(_explorer->widget());
   }
 
@@ -0,0 +1,239 @@
+#include "SearchIndex.h"
+#include <algorithm>
+
+namespace UI
+{
+
+SearchIndex::SearchIndex()
+    : _sortedNames(0)
+  {
+  }
+
+void SearchIndex::clear()
+  {
+  _names.clear();
+  _sortedNames = 0;
+  _paths.clear();
+  _trigrams.clear();
+  _characters.clear();
+  }
+
+void SearchIndex::add(quint32 id, const QString &name, const QString &path)
+  {
+  _names.push_back(Name{ name.toLower(), id });
+
+  auto lowerPath = path.toLower();
+  if (_paths.size() <= id)
+    {
+    _paths.resize(id + 1);
+    }
+  _paths[id] = lowerPath;
+
+  auto data = lowerPath.constData();
+  for (int i = 0; i < lowerPath.size(); ++i)
+    {
+    addPosting(_characters[data[i].unicode()], id);
+    if (i + 3 <= lowerPath.size())
+      {
+      addPosting(_trigrams[trigram(data + i)], id);
+      }
+    }
+  }
+
+std::vector<quint32> SearchIndex::find(const QString &pattern, Mode mode) const
+  {
+  auto lower = pattern.toLower();
+  switch (mode)
+    {
+  case Prefix:
+    return findPrefix(lower);
+  case Substring:
+    return findSubstring(lower);
+  case Fuzzy:
+    return findFuzzy(lower);
+    }
+
+  return std::vector<quint32>();
+  }
+
+bool SearchIndex::matches(const QString &name, const QString &path, const QString &pattern, Mode mode)
+  {
+  switch (mode)
+    {
+  case Prefix:
+    return name.startsWith(pattern, Qt::CaseInsensitive);
+  case Substring:
+    if (pattern.size() < 3)
+      {
+      return name.startsWith(pattern, Qt::CaseInsensitive);
+      }
+    return path.contains(pattern, Qt::CaseInsensitive);
+  case Fuzzy:
+    return isSubsequence(pattern.toLower(), path.toLower());
+    }
+
+  return false;
+  }
+
+quint64 SearchIndex::trigram(const QChar *str)
+  {
+  return ((quint64)str[0].unicode() << 32) | ((quint64)str[1].unicode() << 16) | str[2].unicode();
+  }
+
+bool SearchIndex::isSubsequence(const QString &pattern, const QString &str)
+  {
+  int p = 0;
+  for (int i = 0; i < str.size() && p < pattern.size(); ++i)
+    {
+    if (str[i] == pattern[p])
+      {
+      ++p;
+      }
+    }
+  return p == pattern.size();
+  }
+
+void SearchIndex::addPosting(std::vector<quint32> &list, quint32 id)
+  {
+  // Ids arrive in order, so a repeat within one path is always at the back.
+  if (list.empty() || list.back() != id)
+    {
+    list.push_back(id);
+    }
+  }
+
+std::vector<quint32> SearchIndex::intersect(std::vector<const std::vector<quint32> *> &lists) const
+  {
+  if (lists.empty())
+    {
+    return std::vector<quint32>();
+    }
+
+  // Walk the shortest list, and binary search the others.
+  std::sort(lists.begin(), lists.end(), [](const std::vector<quint32> *a, const std::vector<quint32> *b)
+    {
+    return a->size() < b->size();
+    });
+
+  std::vector<quint32> result;
+  xForeach(auto id, *lists.front())
+    {
+    bool found = true;
+    for (size_t i = 1; i < lists.size() && found; ++i)
+      {
+      found = std::binary_search(lists[i]->begin(), lists[i]->end(), id);
+      }
+
+    if (found)
+      {
+      result.push_back(id);
+      }
+    }
+
+  return result;
+  }
+
+void SearchIndex::mergeNames() const
+  {
+  if (_sortedNames == _names.size())
+    {
+    return;
+    }
+
+  auto lessThan = [](const Name &a, const Name &b)
+    {
+    return a.text < b.text;
+    };
+
+  auto added = _names.begin() + _sortedNames;
+  std::sort(added, _names.end(), lessThan);
+  std::inplace_merge(_names.begin(), added, _names.end(), lessThan);
+  _sortedNames = _names.size();
+  }
+
+std::vector<quint32> SearchIndex::findPrefix(const QString &pattern) const
+  {
+  auto lessThan = [](const Name &a, const Name &b)
+    {
+    return a.text < b.text;
+    };
+
+  mergeNames();
+
+  std::vector<quint32> result;
+  auto it = std::lower_bound(_names.begin(), _names.end(), Name{ pattern, 0 }, lessThan);
+  for (; it != _names.end() && it->text.startsWith(pattern); ++it)
+    {
+    result.push_back(it->id);
+    }
+
+  std::sort(result.begin(), result.end());
+  return result;
+  }
+
+std::vector<quint32> SearchIndex::findSubstring(const QString &pattern) const
+  {
+  // Too short to have a trigram, fall back to matching the start of names.
+  if (pattern.size() < 3)
+    {
+    return findPrefix(pattern);
+    }
+
+  std::vector<const std::vector<quint32> *> lists;
+  for (int i = 0; i + 3 <= pattern.size(); ++i)
+    {
+    auto it = _trigrams.find(trigram(pattern.constData() + i));
+    if (it == _trigrams.end())
+      {
+      return std::vector<quint32>();
+      }
+    lists.push_back(&it.value());
+    }
+
+  auto candidates = intersect(lists);
+
+  // Sharing every trigram doesn't mean they are in the right order.
+  std::vector<quint32> result;
+  xForeach(auto id, candidates)
+    {
+    if (_paths[id].contains(pattern))
+      {
+      result.push_back(id);
+      }
+    }
+
+  return result;
+  }
+
+std::vector<quint32> SearchIndex::findFuzzy(const QString &pattern) const
+  {
+  std::vector<const std::vector<quint32> *> lists;
+  xForeach(auto c, pattern)
+    {
+    auto it = _characters.find(c.unicode());
+    if (it == _characters.end())
+      {
+      return std::vector<quint32>();
+      }
+
+    if (std::find(lists.begin(), lists.end(), &it.value()) == lists.end())
+      {
+      lists.push_back(&it.value());
+      }
+    }
+
+  auto candidates = intersect(lists);
+
+  std::vector<quint32> result;
+  xForeach(auto id, candidates)
+    {
+    if (isSubsequence(pattern, _paths[id]))
+      {
+      result.push_back(id);
+      }
+    }
+
+  return result;
+  }
+
+}
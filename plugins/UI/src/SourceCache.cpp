@@ -0,0 +1,91 @@
+#include "SourceCache.h"
+#include "QtCore/QFileInfo"
+
+namespace UI
+{
+
+SourceCache::SourceCache(size_t maximumUnused)
+    : _maximumUnused(maximumUnused)
+  {
+  connect(&_watcher, SIGNAL(fileChanged(QString)), this, SLOT(onFileChanged(QString)));
+  }
+
+SourceFile::Pointer SourceCache::file(const QString &path)
+  {
+  auto it = _files.find(path);
+  if (it != _files.end())
+    {
+    _recent.splice(_recent.begin(), _recent, it->recent);
+    return it->file;
+    }
+
+  auto file = std::make_shared<SourceFile>(path);
+  if (!file->isOpen())
+    {
+    return file;
+    }
+
+  _recent.push_front(path);
+  _files.insert(path, Entry{ file, _recent.begin() });
+  _watcher.addPath(path);
+
+  trim();
+  return file;
+  }
+
+QDateTime SourceCache::lastModified(const QString &path) const
+  {
+  auto it = _files.find(path);
+  if (it != _files.end())
+    {
+    return it->file->lastModified();
+    }
+
+  return QFileInfo(path).lastModified();
+  }
+
+void SourceCache::clear()
+  {
+  if (!_files.isEmpty())
+    {
+    _watcher.removePaths(_files.keys());
+    }
+
+  _files.clear();
+  _recent.clear();
+  }
+
+void SourceCache::onFileChanged(const QString &path)
+  {
+  auto it = _files.find(path);
+  if (it != _files.end())
+    {
+    _recent.erase(it->recent);
+    _files.erase(it);
+    }
+
+  // Editors that replace the file lose the watch, it is added again when the file is next opened.
+  _watcher.removePath(path);
+  emit fileChanged(path);
+  }
+
+void SourceCache::trim()
+  {
+  // Files still referenced cost nothing extra to keep, only evict the unused ones.
+  size_t unused = 0;
+  for (auto it = _recent.begin(); it != _recent.end();)
+    {
+    auto entry = _files.find(*it);
+    if (entry->file.use_count() > 1 || ++unused <= _maximumUnused)
+      {
+      ++it;
+      continue;
+      }
+
+    _watcher.removePath(*it);
+    _files.erase(entry);
+    it = _recent.erase(it);
+    }
+  }
+
+}
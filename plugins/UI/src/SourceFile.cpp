@@ -0,0 +1,216 @@
+#include "SourceFile.h"
+#include "QtCore/QFileInfo"
+#include <algorithm>
+#include <cstring>
+
+namespace UI
+{
+
+namespace
+{
+
+// Lines found between publishing them to the view.
+const size_t indexBatchSize = 64 * 1024;
+
+// Bytes of a copied file read at a time, each chunk is shown as it arrives.
+const qint64 readChunkSize = 4 * 1024 * 1024;
+
+}
+
+SourceFile::SourceFile(const QString &path)
+    : _path(path),
+      _file(path),
+      _data(nullptr),
+      _size(0),
+      _open(false),
+      _writable(false),
+      _available(0),
+      _longestLine(0),
+      _indexed(false),
+      _cancelled(false)
+  {
+  _lineStarts.push_back(0);
+
+  if (!_file.open(QFile::ReadOnly))
+    {
+    _indexed = true;
+    return;
+    }
+
+  _open = true;
+  QFileInfo info(_file);
+  _lastModified = info.lastModified();
+  _writable = info.isWritable();
+  _size = _file.size();
+
+  // Small files, and pipes which don't know their size, are read and indexed quicker than a thread can be started.
+  if (!isLarge())
+    {
+    _buffer = _file.readAll();
+    _file.close();
+    _size = _buffer.size();
+    _data = _buffer.constData();
+    _available = _size;
+
+    buildIndex();
+    return;
+    }
+
+  // A writable file could be truncated by another program while it is mapped, and reading past
+  // the new end of a mapping faults, so only read only files are mapped.
+  if (!_writable)
+    {
+    _data = (const char *)_file.map(0, _size);
+    _available = _data ? _size : 0;
+    }
+
+  // The rest, and network filesystems that can't be mapped, are copied by the indexer.
+  if (!_data)
+    {
+    _copy.reset(new char[_size]);
+    _data = _copy.get();
+    }
+
+  _indexer = std::thread([this]() { buildIndex(); });
+  }
+
+SourceFile::~SourceFile()
+  {
+  _cancelled = true;
+  if (_indexer.joinable())
+    {
+    _indexer.join();
+    }
+  }
+
+size_t SourceFile::lineCount() const
+  {
+  std::lock_guard<std::mutex> l(_lock);
+  return _lineStarts.size();
+  }
+
+QString SourceFile::text() const
+  {
+  return QString::fromUtf8(_data, (int)available());
+  }
+
+quint64 SourceFile::available() const
+  {
+  std::lock_guard<std::mutex> l(_lock);
+  return _available;
+  }
+
+QString SourceFile::line(size_t line) const
+  {
+  quint64 start = 0;
+  quint64 end = 0;
+
+  {
+  std::lock_guard<std::mutex> l(_lock);
+  if (line >= _lineStarts.size())
+    {
+    return QString();
+    }
+
+  start = _lineStarts[line];
+  end = line + 1 < _lineStarts.size() ? _lineStarts[line + 1] : _available;
+  }
+
+  // The last line found while indexing may not be complete yet, stop at its newline either way.
+  auto newline = (const char *)memchr(_data + start, '\n', end - start);
+  if (newline)
+    {
+    end = newline - _data;
+    }
+
+  if (end > start && _data[end - 1] == '\r')
+    {
+    --end;
+    }
+
+  return QString::fromUtf8(_data + start, (int)(end - start));
+  }
+
+void SourceFile::buildIndex()
+  {
+  std::vector<quint64> found;
+  found.reserve(indexBatchSize);
+
+  // Copied files are read here a chunk at a time, the rest are already available.
+  char *copy = _copy.get();
+  quint64 available = copy ? 0 : _available;
+  quint64 lineStart = 0;
+  size_t longest = 0;
+
+  auto publish = [&]()
+    {
+    {
+    std::lock_guard<std::mutex> l(_lock);
+    _lineStarts.insert(_lineStarts.end(), found.begin(), found.end());
+    _available = available;
+    }
+
+    found.clear();
+    _longestLine = longest;
+    };
+
+  bool reading = copy != nullptr;
+  quint64 scanned = 0;
+  while (!_cancelled)
+    {
+    if (reading)
+      {
+      auto read = _file.read(copy + available, std::min<qint64>(readChunkSize, _size - available));
+      if (read > 0)
+        {
+        available += read;
+        }
+
+      // A file truncated since it was opened shows as much as could be read.
+      reading = read > 0 && available < (quint64)_size;
+      }
+
+    while (scanned < available)
+      {
+      auto newline = (const char *)memchr(_data + scanned, '\n', available - scanned);
+      if (!newline)
+        {
+        scanned = available;
+        break;
+        }
+
+      quint64 offset = newline - _data;
+      longest = std::max(longest, (size_t)(offset - lineStart));
+      lineStart = offset + 1;
+      scanned = lineStart;
+
+      // A trailing newline doesn't start another line.
+      if (lineStart < available || reading)
+        {
+        found.push_back(lineStart);
+        }
+
+      if (found.size() == indexBatchSize)
+        {
+        publish();
+        emit linesAdded();
+        }
+      }
+
+    if (!reading)
+      {
+      break;
+      }
+
+    // Show each chunk as it is read, even if it held fewer lines than a batch.
+    publish();
+    emit linesAdded();
+    }
+
+  longest = std::max(longest, (size_t)(available - lineStart));
+  publish();
+  _indexed = true;
+  emit linesAdded();
+  }
+
+}
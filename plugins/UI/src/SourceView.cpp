@@ -0,0 +1,365 @@
+#include "SourceView.h"
+#include "QMouseEvent"
+#include "QPainter"
+#include "QPaintEvent"
+#include "QScrollBar"
+
+namespace UI
+{
+
+namespace
+{
+
+const int tabWidth = 4;
+const int textMargin = 4;
+
+class SourceViewMargin : public QWidget
+  {
+public:
+  SourceViewMargin(SourceView *view) : QWidget(view), _view(view)
+    {
+    }
+
+  QSize sizeHint() const X_OVERRIDE
+    {
+    return QSize(_view->marginWidth(), 0);
+    }
+
+protected:
+  void paintEvent(QPaintEvent *event) X_OVERRIDE
+    {
+    _view->marginPaintEvent(event);
+    }
+
+  void mouseReleaseEvent(QMouseEvent *event) X_OVERRIDE
+    {
+    _view->marginMouseReleaseEvent(event);
+    }
+
+private:
+  SourceView *_view;
+  };
+
+QString expandTabs(const QString &line)
+  {
+  if (!line.contains(QLatin1Char('\t')))
+    {
+    return line;
+    }
+
+  QString result;
+  result.reserve(line.size() + tabWidth * 4);
+  xForeach(auto c, line)
+    {
+    if (c == QLatin1Char('\t'))
+      {
+      result.append(QString(tabWidth - result.size() % tabWidth, QLatin1Char(' ')));
+      }
+    else
+      {
+      result.append(c);
+      }
+    }
+  return result;
+  }
+
+}
+
+SourceView::SourceView(const SourceFile::Pointer &file, QWidget *parent)
+    : QAbstractScrollArea(parent),
+      _file(file),
+      _lineCount(0),
+      _currentLine(-1),
+      _pendingFocus(-1)
+  {
+  _margin = new SourceViewMargin(this);
+
+  connect(_file.get(), SIGNAL(linesAdded()), this, SLOT(linesAdded()));
+  linesAdded();
+  updateMargin();
+  }
+
+void SourceView::setFile(const SourceFile::Pointer &file)
+  {
+  disconnect(_file.get(), SIGNAL(linesAdded()), this, SLOT(linesAdded()));
+  _file = file;
+  connect(_file.get(), SIGNAL(linesAdded()), this, SLOT(linesAdded()));
+
+  linesAdded();
+  updateMargin();
+  }
+
+void SourceView::focusOnLine(int line)
+  {
+  if (line > (int)_lineCount)
+    {
+    _pendingFocus = line;
+    return;
+    }
+
+  _pendingFocus = -1;
+  scrollToLine(line);
+  }
+
+void SourceView::addBreakpoint(int line)
+  {
+  _breakpoints.insert(line);
+  _margin->update();
+  }
+
+void SourceView::removeBreakpoint(int line)
+  {
+  auto it = _breakpoints.find(line);
+  if (it != _breakpoints.end())
+    {
+    _breakpoints.erase(it);
+    _margin->update();
+    }
+  }
+
+void SourceView::clearBreakpoints()
+  {
+  _breakpoints.clear();
+  _margin->update();
+  }
+
+void SourceView::setBreakpoints(const Eks::Vector<size_t> &lines)
+  {
+  _breakpoints.clear();
+  xForeach(auto line, lines)
+    {
+    _breakpoints.insert((int)line);
+    }
+  _margin->update();
+  }
+
+void SourceView::addActiveLine(int line)
+  {
+  _activeLines.insert(line);
+  viewport()->update();
+  }
+
+void SourceView::removeActiveLine(int line)
+  {
+  if (_activeLines.erase(line))
+    {
+    viewport()->update();
+    }
+  }
+
+void SourceView::clearActiveLines()
+  {
+  _activeLines.clear();
+  viewport()->update();
+  }
+
+void SourceView::setActiveLines(const Eks::Vector<size_t> &lines)
+  {
+  _activeLines.clear();
+  xForeach(auto line, lines)
+    {
+    _activeLines.insert((int)line);
+    }
+  viewport()->update();
+  }
+
+void SourceView::setCurrentLine(int line)
+  {
+  _currentLine = line;
+  viewport()->update();
+  _margin->update();
+  }
+
+int SourceView::marginWidth() const
+  {
+  int digits = 1;
+  size_t max = std::max<size_t>(1, _lineCount);
+  while (max >= 10)
+    {
+    max /= 10;
+    ++digits;
+    }
+
+  return 10 + fontMetrics().width(QLatin1Char('9')) * digits;
+  }
+
+void SourceView::marginPaintEvent(QPaintEvent *event)
+  {
+  QPainter painter(_margin);
+  painter.fillRect(event->rect(), Qt::lightGray);
+
+  const int width = _margin->width() - 5;
+  const int height = lineHeight();
+  const int first = verticalScrollBar()->value();
+  const int last = std::min(first + visibleLineCount(), (int)_lineCount);
+
+  auto breakpoint = _breakpoints.lower_bound(first + 1);
+  for (int i = first; i < last; ++i)
+    {
+    const int line = i + 1;
+    const int top = (i - first) * height;
+    if (top > event->rect().bottom())
+      {
+      break;
+      }
+
+    painter.setPen(Qt::black);
+    painter.drawText(0, top, width, height, Qt::AlignRight, QString::number(line));
+
+    int breakpointCount = 0;
+    while (breakpoint != _breakpoints.end() && *breakpoint == line)
+      {
+      int offset = std::min(breakpointCount * 3, width - height);
+
+      painter.setBrush(Qt::red);
+      painter.drawEllipse(2 + offset, top, height, height);
+
+      ++breakpointCount;
+      ++breakpoint;
+      }
+
+    if (_currentLine == line)
+      {
+      painter.setBrush(Qt::yellow);
+      painter.drawRect(width - height, top + 5, height, height - 10);
+      }
+    }
+  }
+
+void SourceView::marginMouseReleaseEvent(QMouseEvent *event)
+  {
+  int line = verticalScrollBar()->value() + event->pos().y() / lineHeight() + 1;
+  if (line <= (int)_lineCount)
+    {
+    emit marginClicked(line);
+    }
+  }
+
+void SourceView::paintEvent(QPaintEvent *event)
+  {
+  QPainter painter(viewport());
+  painter.fillRect(event->rect(), palette().base());
+
+  const int height = lineHeight();
+  const int ascent = fontMetrics().ascent();
+  const int x = textMargin - horizontalScrollBar()->value();
+  const int width = viewport()->width();
+  const int first = verticalScrollBar()->value();
+  const int last = std::min(first + visibleLineCount(), (int)_lineCount);
+
+  const QColor activeColour = QColor(Qt::darkGray).lighter(160);
+  const QColor currentColour = QColor(Qt::yellow).lighter(160);
+
+  painter.setPen(palette().text().color());
+  for (int i = first; i < last; ++i)
+    {
+    const int line = i + 1;
+    const int top = (i - first) * height;
+    if (top > event->rect().bottom())
+      {
+      break;
+      }
+
+    if (line == _currentLine)
+      {
+      painter.fillRect(0, top, width, height, currentColour);
+      }
+    else if (_activeLines.find(line) != _activeLines.end())
+      {
+      painter.fillRect(0, top, width, height, activeColour);
+      }
+
+    painter.drawText(x, top + ascent, expandTabs(_file->line(i)));
+    }
+  }
+
+void SourceView::resizeEvent(QResizeEvent *event)
+  {
+  QAbstractScrollArea::resizeEvent(event);
+
+  QRect cr = contentsRect();
+  _margin->setGeometry(QRect(cr.left(), cr.top(), marginWidth(), cr.height()));
+  updateScrollBars();
+  }
+
+void SourceView::scrollContentsBy(int, int dy)
+  {
+  viewport()->update();
+  if (dy)
+    {
+    _margin->update();
+    }
+  }
+
+void SourceView::changeEvent(QEvent *event)
+  {
+  QAbstractScrollArea::changeEvent(event);
+  if (event->type() == QEvent::FontChange)
+    {
+    updateMargin();
+    }
+  }
+
+void SourceView::linesAdded()
+  {
+  auto oldWidth = marginWidth();
+  _lineCount = _file->lineCount();
+  if (marginWidth() != oldWidth)
+    {
+    updateMargin();
+    }
+  else
+    {
+    updateScrollBars();
+    }
+
+  if (_pendingFocus != -1 && (_pendingFocus <= (int)_lineCount || _file->isIndexed()))
+    {
+    focusOnLine(std::min(_pendingFocus, (int)_lineCount));
+    }
+
+  viewport()->update();
+  _margin->update();
+  }
+
+int SourceView::lineHeight() const
+  {
+  return std::max(1, fontMetrics().height());
+  }
+
+int SourceView::visibleLineCount() const
+  {
+  return viewport()->height() / lineHeight() + 1;
+  }
+
+void SourceView::updateScrollBars()
+  {
+  int page = std::max(1, viewport()->height() / lineHeight());
+  verticalScrollBar()->setRange(0, std::max(0, (int)_lineCount - page));
+  verticalScrollBar()->setPageStep(page);
+  verticalScrollBar()->setSingleStep(1);
+
+  // Approximate, the longest line is only known in bytes.
+  int charWidth = fontMetrics().width(QLatin1Char('9'));
+  int contentWidth = (int)std::min<size_t>(_file->longestLine(), 1 << 16) * charWidth + textMargin * 2;
+  horizontalScrollBar()->setRange(0, std::max(0, contentWidth - viewport()->width()));
+  horizontalScrollBar()->setPageStep(viewport()->width());
+  horizontalScrollBar()->setSingleStep(charWidth);
+  }
+
+void SourceView::updateMargin()
+  {
+  setViewportMargins(marginWidth(), 0, 0, 0);
+
+  QRect cr = contentsRect();
+  _margin->setGeometry(QRect(cr.left(), cr.top(), marginWidth(), cr.height()));
+  updateScrollBars();
+  }
+
+void SourceView::scrollToLine(int line)
+  {
+  // Centre the line, as QPlainTextEdit's ensureCursorVisible roughly does.
+  verticalScrollBar()->setValue(std::max(0, line - 1 - visibleLineCount() / 2));
+  }
+
+}
@@ -22,6 +22,8 @@ TypeEditor::TypeEditor(TypeManager *types, const QString &path)
     throw NoSuchTypeException();
     }
 
+  types->resolveDefinitions(_type);
+
   ui->setupUi(this);
 
   if (_type->definitions.size())
@@ -0,0 +1,220 @@
+#include "TypeIndex.h"
+#include "QtCore/QCryptographicHash"
+#include "QtCore/QDateTime"
+#include "QtCore/QDir"
+#include "QtCore/QFile"
+#include "QtCore/QFileInfo"
+#include "QtCore/QHash"
+#include "QtCore/QSaveFile"
+#include "QtCore/QStandardPaths"
+#include <cstring>
+
+namespace UI
+{
+
+namespace
+{
+
+const char Magic[4] = { 'D', 'B', 'T', 'I' };
+const quint32 Version = 1;
+
+struct Header
+  {
+  char magic[4];
+  quint32 version;
+  qint64 modified;
+  quint32 uuid;
+  quint32 modulePath;
+  quint32 recordCount;
+  quint32 stringsSize;
+  };
+
+struct Record
+  {
+  enum
+    {
+    Declared = 1
+    };
+
+  quint32 path;
+  quint32 parent;
+  quint32 basename;
+  quint32 specialisation;
+  quint32 file;
+  quint32 line;
+  quint32 flags;
+  };
+
+qint64 modifiedTime(const QString &path)
+  {
+  QFileInfo info(path);
+  if (!info.exists())
+    {
+    return -1;
+    }
+
+  return info.lastModified().toMSecsSinceEpoch();
+  }
+
+}
+
+QString TypeIndex::indexPath(const QString &modulePath)
+  {
+  auto hash = QCryptographicHash::hash(modulePath.toUtf8(), QCryptographicHash::Sha1).toHex();
+  return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/types/" + hash + ".index";
+  }
+
+bool TypeIndex::load(const Module::Pointer &module, std::vector<Entry> &entries)
+  {
+  QString modulePath = module->path().data();
+  qint64 modified = modifiedTime(modulePath);
+  if (modified < 0)
+    {
+    return false;
+    }
+
+  QFile file(indexPath(modulePath));
+  if (!file.open(QIODevice::ReadOnly) || file.size() < (qint64)sizeof(Header))
+    {
+    return false;
+    }
+
+  auto size = file.size();
+  auto data = file.map(0, size);
+  if (!data)
+    {
+    return false;
+    }
+
+  auto unmap = [&](bool result)
+    {
+    file.unmap(data);
+    return result;
+    };
+
+  Header header;
+  memcpy(&header, data, sizeof(Header));
+
+  auto stringsBegin = sizeof(Header) + (qint64)header.recordCount * sizeof(Record);
+  if (memcmp(header.magic, Magic, sizeof(Magic)) != 0 ||
+      header.version != Version ||
+      header.modified != modified ||
+      stringsBegin + header.stringsSize != (quint64)size)
+    {
+    return unmap(false);
+    }
+
+  auto records = data + sizeof(Header);
+  auto strings = reinterpret_cast<const char *>(data + stringsBegin);
+  auto string = [&](quint32 offset)
+    {
+    if (offset >= header.stringsSize)
+      {
+      return QString();
+      }
+    return QString::fromUtf8(strings + offset, (int)qstrnlen(strings + offset, header.stringsSize - offset));
+    };
+
+  if (string(header.modulePath) != modulePath || string(header.uuid) != module->uuid().data())
+    {
+    return unmap(false);
+    }
+
+  entries.clear();
+  entries.reserve(header.recordCount);
+  for (quint32 i = 0; i < header.recordCount; ++i)
+    {
+    Record record;
+    memcpy(&record, records + i * sizeof(Record), sizeof(Record));
+
+    if (record.parent != NoParent && record.parent >= i)
+      {
+      entries.clear();
+      return unmap(false);
+      }
+
+    Entry entry;
+    entry.path = string(record.path);
+    entry.parent = record.parent;
+    entry.basename = string(record.basename);
+    entry.specialisation = string(record.specialisation);
+    entry.file = string(record.file);
+    entry.line = record.line;
+    entry.declared = (record.flags & Record::Declared) != 0;
+    entries.push_back(entry);
+    }
+
+  return unmap(true);
+  }
+
+bool TypeIndex::save(const Module::Pointer &module, const std::vector<Entry> &entries)
+  {
+  QString modulePath = module->path().data();
+  qint64 modified = modifiedTime(modulePath);
+  if (modified < 0)
+    {
+    return false;
+    }
+
+  QByteArray strings;
+  QHash<QString, quint32> offsets;
+  auto string = [&](const QString &str)
+    {
+    auto it = offsets.find(str);
+    if (it != offsets.end())
+      {
+      return it.value();
+      }
+
+    quint32 offset = strings.size();
+    strings.append(str.toUtf8());
+    strings.append('\0');
+    offsets.insert(str, offset);
+    return offset;
+    };
+
+  // Zeroed so the padding written out is too.
+  Header header;
+  memset(&header, 0, sizeof(Header));
+  memcpy(header.magic, Magic, sizeof(Magic));
+  header.version = Version;
+  header.modified = modified;
+  header.uuid = string(module->uuid().data());
+  header.modulePath = string(modulePath);
+  header.recordCount = (quint32)entries.size();
+
+  QByteArray records;
+  records.reserve((int)(entries.size() * sizeof(Record)));
+  xForeach(const auto &entry, entries)
+    {
+    Record record;
+    memset(&record, 0, sizeof(Record));
+    record.path = string(entry.path);
+    record.parent = entry.parent;
+    record.basename = string(entry.basename);
+    record.specialisation = string(entry.specialisation);
+    record.file = string(entry.file);
+    record.line = entry.line;
+    record.flags = entry.declared ? Record::Declared : 0;
+
+    records.append(reinterpret_cast<const char *>(&record), sizeof(Record));
+    }
+
+  header.stringsSize = strings.size();
+
+  QString path = indexPath(modulePath);
+  QDir().mkpath(QFileInfo(path).absolutePath());
+
+  QSaveFile file(path);
+  if (!file.open(QIODevice::WriteOnly))
+    {
+    return false;
+    }
+
+  file.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+  file.write(records);
+  file.write(strings);
+  return file.commit();
+  }
+
+}
@@ -1,8 +1,12 @@
 #include "TypeManager.h"
+#include "TypeIndex.h"
 #include "CompileUnit.h"
 #include "QtCore/QThread"
 #include "Containers/XStringBuilder.h"
 #include "QDebug"
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
 
 namespace UI
 {
@@ -13,10 +17,12 @@ CachedType::CachedType()
   }
 
 TypeManager::TypeManager()
+    : _cancelled(false),
+      _generation(0)
   {
   qRegisterMetaType<LldbDriver::Type*>();
   qRegisterMetaType<CachedType::Pointer>();
-  _workerThread = nullptr;
+  qRegisterMetaType<CachedTypeList>();
   }
 
 TypeManager::~TypeManager()
@@ -27,76 +33,239 @@ TypeManager::~TypeManager()
 void TypeManager::setTarget(const Target::Pointer &tar)
   {
   endWorker();
+  ++_generation;
 
   _target = tar;
-  _types.clear();
+  xForeach(auto &shard, _shards)
+    {
+    std::lock_guard<std::mutex> lock(shard.lock);
+    shard.types.clear();
+    }
+
+  _delivered.clear();
+  _waitingChildren.clear();
+  _waitingDeclarations.clear();
 
   if (!_target)
     {
     return;
     }
 
-  startWorker();
-
+  {
+  std::lock_guard<std::mutex> lock(_queueLock);
   for(size_t i = 0; i < _target->moduleCount(); ++i)
     {
-    auto module = _target->moduleAt(i);
-    emit loadTypes(module);
+    _queue.push_back(_target->moduleAt(i));
     }
   }
 
+  startWorker();
+  }
+
 void TypeManager::startWorker()
   {
-  endWorker();
+  _cancelled = false;
+
+  // One worker per core, each pulling modules from the queue until it is empty.
+  auto count = std::max(1, QThread::idealThreadCount());
+  for (int i = 0; i < count; ++i)
+    {
+    auto worker = new TypeManagerWorker(this, _generation);
+    auto thread = new QThread();
+    worker->moveToThread(thread);
 
-  auto worker = new TypeManagerWorker(this);
-  _workerThread = new QThread();
-  worker->moveToThread(_workerThread);
-  _workerThread->start();
+    connect(thread, SIGNAL(started()), worker, SLOT(run()));
+    connect(thread, SIGNAL(finished()), worker, SLOT(deleteLater()));
 
-  connect(this, SIGNAL(loadTypes(Module::Pointer)), worker, SLOT(loadTypes(Module::Pointer)));
+    connect(worker, SIGNAL(loadedTypes(int, Module::Pointer, UI::CachedTypeList)), this, SLOT(loadedTypes(int, Module::Pointer, UI::CachedTypeList)));
+    connect(worker, SIGNAL(loadedTypeDeclarations(int, Module::Pointer, UI::CachedTypeList)), this, SLOT(loadedTypeDeclarations(int, Module::Pointer, UI::CachedTypeList)));
 
-  connect(worker, SIGNAL(loadedType(Module::Pointer, UI::CachedType::Pointer)), this, SLOT(loadedType(Module::Pointer, UI::CachedType::Pointer)));
-  connect(worker, SIGNAL(loadedTypeDeclaration(Module::Pointer,UI::CachedType::Pointer,const Type*)), this, SLOT(loadedTypeDeclaration(Module::Pointer, UI::CachedType::Pointer, const Type*)));
+    thread->start();
+    _workerThreads.push_back(thread);
+    }
   }
 
 void TypeManager::endWorker()
   {
-  if (_workerThread)
+  _cancelled = true;
+
+  {
+  std::lock_guard<std::mutex> lock(_queueLock);
+  _queue.clear();
+  }
+
+  xForeach(auto thread, _workerThreads)
+    {
+    thread->exit();
+    thread->wait();
+    delete thread;
+    }
+  _workerThreads.clear();
+  }
+
+Module::Pointer TypeManager::nextModule()
+  {
+  std::lock_guard<std::mutex> lock(_queueLock);
+  if (_cancelled || _queue.empty())
     {
-    _workerThread->exit();
-    _workerThread->wait();
-    _workerThread = nullptr;
+    return nullptr;
     }
+
+  auto module = _queue.front();
+  _queue.pop_front();
+  return module;
   }
 
-void TypeManager::registerType(const std::shared_ptr<CachedType> &cached)
+TypeManager::Shard &TypeManager::shardFor(const QString &path)
   {
-  std::lock_guard<std::mutex> lock(_typeLock);
-  xAssert(!_types.contains(cached->path));
-  _types[cached->path] = cached;
+  return _shards[qHash(path) % ShardCount];
+  }
+
+std::shared_ptr<CachedType> TypeManager::registerType(const std::shared_ptr<CachedType> &cached)
+  {
+  auto &shard = shardFor(cached->path);
+  std::lock_guard<std::mutex> lock(shard.lock);
+
+  auto &registered = shard.types[cached->path];
+  if (!registered)
+    {
+    registered = cached;
+    }
+  return registered;
   }
 
 std::shared_ptr<CachedType> TypeManager::findType(const QString &str)
   {
-  std::lock_guard<std::mutex> lock(_typeLock);	
+  auto &shard = shardFor(str);
+  std::lock_guard<std::mutex> lock(shard.lock);
+
+  return shard.types.value(str);
+  }
+
+void TypeManager::resolveDefinitions(const std::shared_ptr<CachedType> &type)
+  {
+  std::lock_guard<std::mutex> lock(type->lock);
+  if (type->unresolvedModules.empty())
+    {
+    return;
+    }
+
+  auto name = type->path.toUtf8();
+  xForeach(const auto &module, type->unresolvedModules)
+    {
+    auto types = module->findTypes(name.data());
+    xForeach(const auto &t, types)
+      {
+      if (t.isDataStructure() && type->path == t.name().data())
+        {
+        type->definitions << t;
+        }
+      }
+    }
+
+  type->unresolvedModules.clear();
+  }
+
+void TypeManager::loadedTypes(int generation, const Module::Pointer &module, const UI::CachedTypeList &types)
+  {
+  if (generation != _generation)
+    {
+    return;
+    }
+
+  ModuleTypes delivered;
+  ModuleTypes declarations;
+  xForeach(const auto &type, types)
+    {
+    // The parent may be in a batch another worker hasn't sent yet.
+    if (type->parent && _delivered.find(type->parent) == _delivered.end())
+      {
+      _waitingChildren[type->parent].emplace_back(module, type);
+      continue;
+      }
+
+    deliver(module, type, delivered, declarations);
+    }
+
+  emitDelivered(delivered, declarations);
+  }
+
+void TypeManager::loadedTypeDeclarations(int generation, const Module::Pointer &module, const UI::CachedTypeList &types)
+  {
+  if (generation != _generation)
+    {
+    return;
+    }
+
+  ModuleTypes declarations;
+  xForeach(const auto &type, types)
+    {
+    if (_delivered.find(type) == _delivered.end())
+      {
+      _waitingDeclarations[type].emplace_back(module, type);
+      continue;
+      }
+
+    declarations[module].push_back(type);
+    }
+
+  emitDelivered(ModuleTypes(), declarations);
+  }
+
+void TypeManager::deliver(const Module::Pointer &module, const CachedType::Pointer &type, ModuleTypes &types, ModuleTypes &declarations)
+  {
+  _delivered.insert(type);
+  types[module].push_back(type);
+
+  auto waitingDeclarations = _waitingDeclarations.find(type);
+  if (waitingDeclarations != _waitingDeclarations.end())
+    {
+    xForeach(const auto &declaration, waitingDeclarations->second)
+      {
+      declarations[declaration.first].push_back(declaration.second);
+      }
+    _waitingDeclarations.erase(waitingDeclarations);
+    }
+
+  auto waitingChildren = _waitingChildren.find(type);
+  if (waitingChildren != _waitingChildren.end())
+    {
+    auto children = std::move(waitingChildren->second);
+    _waitingChildren.erase(waitingChildren);
 
-  return _types.value(str);
+    xForeach(const auto &child, children)
+      {
+      deliver(child.first, child.second, types, declarations);
+      }
+    }
   }
 
-void TypeManager::loadedType(const Module::Pointer &module, const UI::CachedType::Pointer &cached)
+void TypeManager::emitDelivered(const ModuleTypes &types, const ModuleTypes &declarations)
   {
-  emit typeAdded(module, cached);
+  // Types go first, so declarations never arrive before the type they declare.
+  xForeach(const auto &module, types)
+    {
+    emit typesAdded(module.first, module.second);
+    }
+
+  xForeach(const auto &module, declarations)
+    {
+    emit typeDeclarationsAdded(module.first, module.second);
+    }
   }
 
-void TypeManager::loadedTypeDeclaration(const Module::Pointer &module, const UI::CachedType::Pointer &cached, const Type *type)
+TypeManagerWorker::TypeManagerWorker(TypeManager *mgr, int generation)
+    : _manager(mgr),
+      _generation(generation)
   {
-  emit typeDeclarationAdded(module, cached, type);
   }
 
-TypeManagerWorker::TypeManagerWorker(TypeManager *mgr)
-    : _manager(mgr)
+void TypeManagerWorker::run()
   {
+  while (auto module = _manager->nextModule())
+    {
+    loadTypes(module);
+    }
   }
 
 template <typename T> T skipBracesUntil(const T &beg, const T &end, Eks::String::Char left, Eks::String::Char right, Eks::String::Char until, T &lastBrace)
@@ -163,10 +332,28 @@ void splitPath(const Eks::String &path, Eks::StringBuilder &parent, Eks::StringB
 
 void TypeManagerWorker::loadTypes(const Module::Pointer &ptr)
   {
+  if (loadIndex(ptr))
+    {
+    flush(ptr);
+    return;
+    }
+
+  _moduleTypes.clear();
+  _moduleDeclarations.clear();
+
   auto units = ptr->compileUnits();
 
   xForeach(const auto &unit, units)
     {
+    if (_manager->isCancelled())
+      {
+      // Don't write an index for a partly loaded module.
+      _moduleTypes.clear();
+      _moduleDeclarations.clear();
+      flush(ptr);
+      return;
+      }
+
     xForeach(const auto &type, unit->types())
       {
       if (type.isDataStructure())
@@ -174,7 +361,114 @@ void TypeManagerWorker::loadTypes(const Module::Pointer &ptr)
         loadType(ptr, type);
         }
       }
+
+    // A unit may hold no new types, and reading the next one can be slow,
+    // so check the age here too rather than only as types arrive.
+    flushIfDue(ptr);
+    }
+
+  flush(ptr);
+  saveIndex(ptr);
+  }
+
+bool TypeManagerWorker::loadIndex(const Module::Pointer &module)
+  {
+  std::vector<TypeIndex::Entry> entries;
+  if (!TypeIndex::load(module, entries))
+    {
+    return false;
+    }
+
+  std::vector<std::shared_ptr<CachedType>> types;
+  types.reserve(entries.size());
+
+  xForeach(const auto &entry, entries)
+    {
+    auto type = _manager->findType(entry.path);
+    if (!type)
+      {
+      type = std::make_shared<CachedType>();
+      type->parent = entry.parent != TypeIndex::NoParent ? types[entry.parent] : nullptr;
+      type->path = entry.path;
+      type->basename = entry.basename;
+      type->specialisation = entry.specialisation;
+      type->line = 0;
+
+      auto registered = _manager->registerType(type);
+      if (registered == type)
+        {
+        typeLoaded(module, type);
+        }
+      type = registered;
+      }
+
+    if (entry.declared)
+      {
+      {
+      std::lock_guard<std::mutex> lock(type->lock);
+      type->unresolvedModules.push_back(module);
+      if (!entry.file.isEmpty())
+        {
+        type->file = entry.file;
+        type->line = entry.line;
+        }
+      }
+
+      declarationLoaded(module, type);
+      }
+
+    types.push_back(type);
+    }
+
+  return true;
+  }
+
+void TypeManagerWorker::saveIndex(const Module::Pointer &module)
+  {
+  std::vector<TypeIndex::Entry> entries;
+  std::unordered_map<CachedType *, quint32> indices;
+
+  // Parents are written before their children, so loading can link them up in one pass.
+  std::function<quint32 (const std::shared_ptr<CachedType> &)> add = [&](const std::shared_ptr<CachedType> &type)
+    {
+    auto it = indices.find(type.get());
+    if (it != indices.end())
+      {
+      return it->second;
+      }
+
+    quint32 parent = type->parent ? add(type->parent) : (quint32)TypeIndex::NoParent;
+
+    TypeIndex::Entry entry;
+    entry.path = type->path;
+    entry.parent = parent;
+    entry.basename = type->basename;
+    entry.specialisation = type->specialisation;
+    {
+    std::lock_guard<std::mutex> lock(type->lock);
+    entry.file = type->file;
+    entry.line = (quint32)type->line;
     }
+    entry.declared = _moduleDeclarations.find(type.get()) != _moduleDeclarations.end();
+
+    quint32 index = (quint32)entries.size();
+    entries.push_back(entry);
+    indices[type.get()] = index;
+    return index;
+    };
+
+  xForeach(const auto &type, _moduleTypes)
+    {
+    add(type);
+    }
+
+  if (!TypeIndex::save(module, entries))
+    {
+    qWarning() << "Failed to write type index for" << module->path().data();
+    }
+
+  _moduleTypes.clear();
+  _moduleDeclarations.clear();
   }
 
 void TypeManagerWorker::loadType(const Module::Pointer &ptr, const Type &t)
@@ -219,31 +513,92 @@ std::shared_ptr<CachedType> TypeManagerWorker::createType(const Module::Pointer
   type->specialisation = specialisation.data();
   type->line = 0;
 
-  _manager->registerType(type);
-  emit loadedType(module, type);
+  // Another worker may have registered the same type while we were splitting the name.
+  auto registered = _manager->registerType(type);
+  if (registered == type)
+    {
+    typeLoaded(module, type);
+    }
 
   if (t)
     {
-    addDeclaration(module, type, t);
+    addDeclaration(module, registered, t);
     }
 
-  return type;
+  return registered;
   }
 
 void TypeManagerWorker::addDeclaration(const Module::Pointer &module, const std::shared_ptr<CachedType> &type, const Type *t)
   {
-  type->definitions << *t;
+  if (_moduleDeclarations.insert(type.get()).second)
+    {
+    _moduleTypes.push_back(type);
+    }
 
   Eks::TemporaryAllocator alloc(Eks::Core::temporaryAllocator());
   Eks::String file;
   size_t line = 0;
-  if (t->getLocation(file, line))
+  bool located = t->getLocation(file, line);
+
+  {
+  std::lock_guard<std::mutex> lock(type->lock);
+  type->definitions << *t;
+  if (located)
     {
     type->file = file.data();
     type->line = line;
     }
+  }
+
+  declarationLoaded(module, type);
+  }
+
+void TypeManagerWorker::typeLoaded(const Module::Pointer &module, const std::shared_ptr<CachedType> &type)
+  {
+  startBatch();
+  _loadedTypes.push_back(type);
+  flushIfDue(module);
+  }
+
+void TypeManagerWorker::declarationLoaded(const Module::Pointer &module, const std::shared_ptr<CachedType> &type)
+  {
+  startBatch();
+  _loadedDeclarations.push_back(type);
+  flushIfDue(module);
+  }
+
+void TypeManagerWorker::startBatch()
+  {
+  if (_loadedTypes.empty() && _loadedDeclarations.empty())
+    {
+    _batchAge.start();
+    }
+  }
+
+void TypeManagerWorker::flushIfDue(const Module::Pointer &module)
+  {
+  auto count = _loadedTypes.size() + _loadedDeclarations.size();
+  if (count >= BatchSize || (count > 0 && _batchAge.elapsed() >= BatchInterval))
+    {
+    flush(module);
+    }
+  }
 
-  emit loadedTypeDeclaration(module, type, t);
+void TypeManagerWorker::flush(const Module::Pointer &module)
+  {
+  // Types go first, so this worker's declarations follow the types it registered.
+  // TypeManager holds back anything depending on another worker's batches.
+  if (!_loadedTypes.empty())
+    {
+    emit loadedTypes(_generation, module, _loadedTypes);
+    _loadedTypes.clear();
+    }
+
+  if (!_loadedDeclarations.empty())
+    {
+    emit loadedTypeDeclarations(_generation, module, _loadedDeclarations);
+    _loadedDeclarations.clear();
+    }
   }
 
 }
@@ -0,0 +1,480 @@
+#include "ValueTree.h"
+#include "Type.h"
+#include "QtWidgets/QTreeView"
+#include "QtWidgets/QHeaderView"
+#include "QtGui/QColor"
+#include <algorithm>
+
+namespace UI
+{
+
+namespace
+{
+
+// Statistics are read on the gui thread when hovered, larger arrays aren't summarised, as their
+// size may be garbage from an uninitialised container.
+const size_t maxStatisticsElements = 1024 * 1024;
+
+}
+
+struct ValueTreeModel::Node
+  {
+  enum Kind
+    {
+    Root,
+    Argument,
+    Local,
+    Child
+    };
+
+  Node(Node *p, int r, Kind k, const Value &v)
+      : parent(p),
+        row(r),
+        kind(k),
+        value(v)
+    {
+    }
+
+  Node(Node *p, int r, const ValueSummary &s)
+      : parent(p),
+        row(r),
+        kind(Child),
+        value(s.child()),
+        checkedChildren(true),
+        hasChildren(s.mightHaveChildren()),
+        described(true),
+        name(s.name().data()),
+        valueString(s.value().data()),
+        typeName(s.typeName().data())
+    {
+    }
+
+  bool mightHaveChildren()
+    {
+    if (kind == Root)
+      {
+      return !children.empty();
+      }
+
+    if (!checkedChildren)
+      {
+      checkedChildren = true;
+      hasChildren = value.mightHaveChildren();
+      }
+    return hasChildren;
+    }
+
+  size_t totalChildren()
+    {
+    if (!counted)
+      {
+      counted = true;
+      childCount = mightHaveChildren() ? value.childCount() : 0;
+      }
+    return childCount;
+    }
+
+  void describe()
+    {
+    if (described)
+      {
+      return;
+      }
+
+    described = true;
+    name = value.name().data();
+    valueString = value.value().data();
+    typeName = value.type().name().data();
+
+    if (valueString.isEmpty() && value.isContiguousArray())
+      {
+      valueString = QString("size=%1").arg(value.childCount());
+      }
+    }
+
+  Node *parent;
+  int row;
+  Kind kind;
+  Value value;
+
+  bool checkedChildren = false;
+  bool hasChildren = false;
+  bool counted = false;
+  size_t childCount = 0;
+
+  bool described = false;
+  bool changed = false;
+  // Read on first hover at each stop.
+  bool statisticsRead = false;
+  ArrayStatistics statistics;
+  QString name;
+  QString valueString;
+  QString typeName;
+
+  std::vector<std::unique_ptr<Node>> children;
+  };
+
+ValueTreeModel::ValueTreeModel(QObject *parent)
+    : QAbstractItemModel(parent),
+      _root(new Node(nullptr, 0, Node::Root, Value())),
+      _values(FrameValues::create())
+  {
+  }
+
+ValueTreeModel::~ValueTreeModel()
+  {
+  }
+
+void ValueTreeModel::setFrame(const Frame &frame)
+  {
+  if (!_values->update(frame))
+    {
+    rebuild();
+    return;
+    }
+
+  // Same frame as last time, un-highlight the last changes and redraw only the rows that differ.
+  auto previous = std::move(_changed);
+  _changed.clear();
+  xForeach(auto node, previous)
+    {
+    node->changed = false;
+    auto index = createIndex(node->row, 0, node);
+    emit dataChanged(index, index.sibling(node->row, ColumnCount - 1));
+    }
+
+  auto changed = _values->changed();
+  size_t next = 0;
+  for (size_t i = 0; i < _root->children.size(); ++i)
+    {
+    bool isChanged = next < changed.size() && changed[next] == i;
+    if (isChanged)
+      {
+      ++next;
+      }
+
+    auto node = _root->children[i].get();
+    refresh(node, createIndex((int)i, 0, node), isChanged);
+    }
+  }
+
+void ValueTreeModel::rebuild()
+  {
+  beginResetModel();
+  _changed.clear();
+  _root.reset(new Node(nullptr, 0, Node::Root, Value()));
+
+  auto count = _values->count();
+  _root->children.reserve(count);
+  for (size_t i = 0; i < count; ++i)
+    {
+    auto kind = _values->isArgument(i) ? Node::Argument : Node::Local;
+    _root->children.emplace_back(new Node(_root.get(), (int)i, kind, _values->valueAt(i)));
+    }
+
+  _root->counted = true;
+  _root->childCount = _root->children.size();
+  endResetModel();
+  }
+
+void ValueTreeModel::refresh(Node *node, const QModelIndex &index, bool changed)
+  {
+  if (changed)
+    {
+    node->described = false;
+    node->changed = true;
+    _changed.push_back(node);
+    emit dataChanged(index, index.sibling(index.row(), ColumnCount - 1));
+
+    // Pointers and arrays can change length, drop anything fetched past the new end,
+    // more is fetched on demand if it grew.
+    node->checkedChildren = false;
+    if (node->counted)
+      {
+      node->childCount = node->mightHaveChildren() ? node->value.childCount() : 0;
+      if (node->childCount < node->children.size())
+        {
+        beginRemoveRows(index, (int)node->childCount, (int)node->children.size() - 1);
+        node->children.resize(node->childCount);
+        endRemoveRows();
+        }
+      }
+    }
+
+  if (node->value.isContiguousArray())
+    {
+    refreshElements(node);
+    return;
+    }
+
+  // Children are only compared once they have been fetched, so collapsed values cost nothing.
+  for (size_t i = 0; i < node->children.size(); ++i)
+    {
+    auto child = node->children[i].get();
+    refresh(child, createIndex((int)i, 0, child), child->value.changed());
+    }
+  }
+
+void ValueTreeModel::refreshElements(Node *node)
+  {
+  // The elements may have changed without the container, so summarise them again when next hovered.
+  node->statisticsRead = false;
+
+  if (node->children.empty())
+    {
+    return;
+    }
+
+  // Elements can move as well as change when a container grows, so read them all again
+  // in one go, rather than asking each old element value if it changed.
+  auto summaries = node->value.summaries(0, node->children.size());
+  for (size_t i = 0; i < node->children.size() && i < summaries.size(); ++i)
+    {
+    auto child = node->children[i].get();
+    const auto &summary = summaries[i];
+    child->value = summary.child();
+
+    QString valueString = summary.value().data();
+    if (valueString == child->valueString)
+      {
+      continue;
+      }
+
+    child->valueString = valueString;
+    child->changed = true;
+    _changed.push_back(child);
+
+    auto index = createIndex((int)i, 0, child);
+    emit dataChanged(index, index.sibling((int)i, ColumnCount - 1));
+    }
+  }
+
+void ValueTreeModel::clear()
+  {
+  beginResetModel();
+  _values->clear();
+  _changed.clear();
+  _root.reset(new Node(nullptr, 0, Node::Root, Value()));
+  endResetModel();
+  }
+
+ValueTreeModel::Node *ValueTreeModel::nodeFor(const QModelIndex &index) const
+  {
+  if (!index.isValid())
+    {
+    return _root.get();
+    }
+
+  return static_cast<Node *>(index.internalPointer());
+  }
+
+QModelIndex ValueTreeModel::index(int row, int column, const QModelIndex &parent) const
+  {
+  if (!hasIndex(row, column, parent))
+    {
+    return QModelIndex();
+    }
+
+  auto node = nodeFor(parent);
+  return createIndex(row, column, node->children[row].get());
+  }
+
+QModelIndex ValueTreeModel::parent(const QModelIndex &child) const
+  {
+  if (!child.isValid())
+    {
+    return QModelIndex();
+    }
+
+  auto parent = nodeFor(child)->parent;
+  if (!parent || parent == _root.get())
+    {
+    return QModelIndex();
+    }
+
+  return createIndex(parent->row, 0, parent);
+  }
+
+int ValueTreeModel::rowCount(const QModelIndex &parent) const
+  {
+  if (parent.column() > 0)
+    {
+    return 0;
+    }
+
+  return (int)nodeFor(parent)->children.size();
+  }
+
+int ValueTreeModel::columnCount(const QModelIndex &) const
+  {
+  return ColumnCount;
+  }
+
+bool ValueTreeModel::hasChildren(const QModelIndex &parent) const
+  {
+  if (parent.column() > 0)
+    {
+    return false;
+    }
+
+  return nodeFor(parent)->mightHaveChildren();
+  }
+
+QVariant ValueTreeModel::data(const QModelIndex &index, int role) const
+  {
+  if (!index.isValid())
+    {
+    return QVariant();
+    }
+
+  auto node = nodeFor(index);
+  if (role == Qt::DisplayRole)
+    {
+    node->describe();
+    switch (index.column())
+      {
+    case NameColumn:
+      return node->name;
+    case ValueColumn:
+      return node->valueString;
+    case TypeColumn:
+      return node->typeName;
+      }
+    }
+  else if (role == Qt::ToolTipRole && index.column() == ValueColumn && node->value.isContiguousArray())
+    {
+    // Read on hover, a million elements take a few milliseconds.
+    if (node->totalChildren() > maxStatisticsElements)
+      {
+      return tr("%1 elements, too many to summarise").arg(node->totalChildren());
+      }
+
+    if (!node->statisticsRead)
+      {
+      node->statisticsRead = true;
+      node->statistics = node->value.statistics();
+      }
+
+    const auto &stats = node->statistics;
+    if (stats.isValid() && stats.count())
+      {
+      return tr("%1 elements\nmin %2\nmax %3\nsum %4\nmean %5")
+          .arg(stats.count())
+          .arg(stats.minimum())
+          .arg(stats.maximum())
+          .arg(stats.sum())
+          .arg(stats.mean());
+      }
+    }
+  else if (role == Qt::ForegroundRole && node->changed && index.column() == ValueColumn)
+    {
+    return QColor(Qt::red);
+    }
+  else if (role == Qt::ToolTipRole && index.column() == NameColumn)
+    {
+    if (node->kind == Node::Argument)
+      {
+      return tr("Argument");
+      }
+    else if (node->kind == Node::Local)
+      {
+      return tr("Local");
+      }
+    }
+
+  return QVariant();
+  }
+
+QVariant ValueTreeModel::headerData(int section, Qt::Orientation orientation, int role) const
+  {
+  if (orientation != Qt::Horizontal || role != Qt::DisplayRole)
+    {
+    return QVariant();
+    }
+
+  switch (section)
+    {
+  case NameColumn:
+    return tr("Name");
+  case ValueColumn:
+    return tr("Value");
+  case TypeColumn:
+    return tr("Type");
+    }
+
+  return QVariant();
+  }
+
+bool ValueTreeModel::canFetchMore(const QModelIndex &parent) const
+  {
+  if (!parent.isValid() || parent.column() > 0)
+    {
+    return false;
+    }
+
+  auto node = nodeFor(parent);
+  return node->children.size() < node->totalChildren();
+  }
+
+void ValueTreeModel::fetchMore(const QModelIndex &parent)
+  {
+  if (!canFetchMore(parent))
+    {
+    return;
+    }
+
+  auto node = nodeFor(parent);
+  size_t first = node->children.size();
+  size_t count = std::min<size_t>(PageSize, node->totalChildren() - first);
+
+  auto summaries = node->value.summaries(first, count);
+  if (summaries.size() == 0)
+    {
+    // The value shrank underneath us, stop asking for more.
+    node->childCount = first;
+    return;
+    }
+
+  beginInsertRows(parent, (int)first, (int)(first + summaries.size() - 1));
+  node->children.reserve(first + summaries.size());
+  xForeach(const auto &summary, summaries)
+    {
+    int row = (int)node->children.size();
+    node->children.emplace_back(new Node(node, row, summary));
+    }
+  endInsertRows();
+  }
+
+ValueTreeDock::ValueTreeDock(bool toolbar)
+    : Dockable(toolbar)
+  {
+  _model = new ValueTreeModel(this);
+
+  _tree = new QTreeView();
+  _tree->setUniformRowHeights(true);
+  _tree->setEditTriggers(QAbstractItemView::NoEditTriggers);
+  _tree->setModel(_model);
+
+  QFont font("Courier New");
+  font.setStyleHint(QFont::Monospace);
+  _tree->setFont(font);
+
+  setWidget(_tree);
+  }
+
+void ValueTreeDock::setFrame(const Frame &frame)
+  {
+  _model->setFrame(frame);
+  }
+
+void ValueTreeDock::clear()
+  {
+  _model->clear();
+  }
+
+void ValueTreeDock::setRunning(bool running)
+  {
+  _tree->setEnabled(!running);
+  }
+
+}
@@ -0,0 +1,301 @@
+#include "WatchView.h"
+#include "QtWidgets/QAction"
+#include "QtWidgets/QHeaderView"
+#include "QtWidgets/QLineEdit"
+#include "QtWidgets/QTreeWidget"
+#include "QtWidgets/QVBoxLayout"
+
+namespace UI
+{
+
+namespace
+{
+
+const int idRole = Qt::UserRole;
+
+QString methodName(EvaluationMethod method)
+  {
+  switch (method)
+    {
+  case EvaluationMethod::Cached:
+    return QObject::tr("cached");
+  case EvaluationMethod::VariablePath:
+    return QObject::tr("variable path");
+  case EvaluationMethod::Expression:
+    return QObject::tr("expression");
+  case EvaluationMethod::Failed:
+    return QObject::tr("failed");
+  default:
+    return QString();
+    }
+  }
+
+QString costString(size_t microseconds)
+  {
+  if (microseconds < 1000)
+    {
+    return QString("%1 us").arg(microseconds);
+    }
+  return QString("%1 ms").arg(microseconds / 1000.0, 0, 'f', 1);
+  }
+
+}
+
+WatchDock::WatchDock(bool toolbar)
+    : Dockable(toolbar),
+      _watches(WatchSet::create()),
+      _updating(false)
+  {
+  _expressionEdit = new QLineEdit();
+  _expressionEdit->setPlaceholderText(tr("Add watch"));
+  connect(_expressionEdit, SIGNAL(returnPressed()), this, SLOT(expressionEntered()));
+
+  _tree = new QTreeWidget();
+  _tree->setColumnCount(ColumnCount);
+  _tree->setHeaderLabels(QStringList() << tr("Expression") << tr("Value") << tr("Type") << tr("Cost"));
+  _tree->setRootIsDecorated(false);
+  _tree->setUniformRowHeights(true);
+  _tree->setSelectionMode(QAbstractItemView::ExtendedSelection);
+  _tree->setEditTriggers(QAbstractItemView::DoubleClicked | QAbstractItemView::EditKeyPressed);
+  connect(_tree, SIGNAL(itemChanged(QTreeWidgetItem*,int)), this, SLOT(itemChanged(QTreeWidgetItem*,int)));
+
+  QFont font("Courier New");
+  font.setStyleHint(QFont::Monospace);
+  _tree->setFont(font);
+
+  auto remove = new QAction(tr("Remove Watch"), _tree);
+  remove->setShortcut(QKeySequence::Delete);
+  remove->setShortcutContext(Qt::WidgetShortcut);
+  connect(remove, SIGNAL(triggered()), this, SLOT(removeSelected()));
+  _tree->addAction(remove);
+
+  // Off by default, running the target from the watch thread competes with the rest of the stop.
+  auto runTarget = new QAction(tr("Evaluate Expressions (May Run Target)"), _tree);
+  runTarget->setCheckable(true);
+  runTarget->setChecked(_watches->evaluator()->policy() == EvaluationPolicy::RunTarget);
+  connect(runTarget, SIGNAL(toggled(bool)), this, SLOT(setRunTarget(bool)));
+  _tree->addAction(runTarget);
+  _tree->setContextMenuPolicy(Qt::ActionsContextMenu);
+
+  auto widget = new QWidget();
+  auto layout = new QVBoxLayout(widget);
+  layout->setContentsMargins(0, 0, 0, 0);
+  layout->setSpacing(0);
+  layout->addWidget(_expressionEdit);
+  layout->addWidget(_tree);
+
+  setWidget(widget);
+
+  // Called on the evaluation thread, hop back to the gui thread to show the result
+  // or release the batch's frame.
+  _watches->setResultCallback([this](size_t id)
+    {
+    QMetaObject::invokeMethod(this, "resultReady", Qt::QueuedConnection, Q_ARG(quint64, id));
+    });
+  }
+
+WatchDock::~WatchDock()
+  {
+  // Waits for a result being delivered, so none arrive once the dock has gone.
+  _watches->setResultCallback(nullptr);
+  }
+
+void WatchDock::addWatch(const QString &expression)
+  {
+  auto trimmed = expression.trimmed();
+  if (trimmed.isEmpty())
+    {
+    return;
+    }
+
+  size_t id = _watches->add(trimmed.toUtf8().data());
+  addItem(id, trimmed);
+
+  if (_frame)
+    {
+    _watches->evaluate(*_frame);
+    }
+  }
+
+void WatchDock::clearWatches()
+  {
+  auto ids = _watches->ids();
+  xForeach(auto id, ids)
+    {
+    _watches->remove(id);
+    }
+
+  _items.clear();
+  _tree->clear();
+  }
+
+size_t WatchDock::watchCount() const
+  {
+  return _tree->topLevelItemCount();
+  }
+
+QString WatchDock::watchExpression(size_t i) const
+  {
+  auto item = _tree->topLevelItem((int)i);
+  if (!item)
+    {
+    return QString();
+    }
+
+  return item->text(ExpressionColumn);
+  }
+
+void WatchDock::evaluate(const Frame &frame)
+  {
+  _frame.reset(new Frame(frame));
+  _watches->evaluate(frame);
+  }
+
+void WatchDock::setRunning(bool running)
+  {
+  if (!running)
+    {
+    return;
+    }
+
+  _frame.reset();
+  _watches->markStale();
+
+  for (auto it = _items.begin(); it != _items.end(); ++it)
+    {
+    update(it.value(), it.key());
+    }
+  }
+
+void WatchDock::clear()
+  {
+  setRunning(true);
+  }
+
+void WatchDock::expressionEntered()
+  {
+  addWatch(_expressionEdit->text());
+  _expressionEdit->clear();
+  }
+
+void WatchDock::removeSelected()
+  {
+  xForeach(auto item, _tree->selectedItems())
+    {
+    auto id = item->data(ExpressionColumn, idRole).value<quint64>();
+    _watches->remove(id);
+    _items.remove(id);
+    delete item;
+    }
+  }
+
+void WatchDock::itemChanged(QTreeWidgetItem *item, int column)
+  {
+  if (_updating || column != ExpressionColumn)
+    {
+    return;
+    }
+
+  auto id = item->data(ExpressionColumn, idRole).value<quint64>();
+  auto expression = item->text(ExpressionColumn).trimmed();
+  if (expression.isEmpty())
+    {
+    _watches->remove(id);
+    _items.remove(id);
+    delete item;
+    return;
+    }
+
+  _watches->setExpression(id, expression.toUtf8().data());
+  update(item, id);
+
+  if (_frame)
+    {
+    _watches->evaluate(*_frame);
+    }
+  }
+
+void WatchDock::resultReady(quint64 id)
+  {
+  if (id == WatchSet::BatchFinished)
+    {
+    _watches->releaseFrames();
+    return;
+    }
+
+  auto item = _items.value(id);
+  if (item)
+    {
+    update(item, id);
+    }
+  }
+
+void WatchDock::setRunTarget(bool run)
+  {
+  _watches->evaluator()->setPolicy(run ? EvaluationPolicy::RunTarget : EvaluationPolicy::VariablesOnly);
+
+  if (_frame)
+    {
+    _watches->evaluate(*_frame);
+    }
+  }
+
+QTreeWidgetItem *WatchDock::addItem(size_t id, const QString &expression)
+  {
+  _updating = true;
+  auto item = new QTreeWidgetItem(_tree);
+  item->setFlags(item->flags() | Qt::ItemIsEditable);
+  item->setText(ExpressionColumn, expression);
+  item->setData(ExpressionColumn, idRole, (quint64)id);
+  _updating = false;
+
+  _items.insert(id, item);
+  update(item, id);
+  return item;
+  }
+
+void WatchDock::update(QTreeWidgetItem *item, size_t id)
+  {
+  auto result = _watches->result(id);
+
+  _updating = true;
+  if (result.isPending())
+    {
+    item->setText(ValueColumn, QString());
+    item->setText(TypeColumn, QString());
+    item->setText(CostColumn, QString());
+    item->setToolTip(ValueColumn, QString());
+    item->setToolTip(CostColumn, QString());
+    }
+  else
+    {
+    bool failed = result.method() == EvaluationMethod::Failed;
+    item->setText(ValueColumn, failed ? result.error().data() : result.valueString().data());
+    item->setText(TypeColumn, result.typeName().data());
+    item->setText(CostColumn, costString(result.cost()));
+
+    item->setToolTip(ValueColumn, result.isStale() ? tr("From an earlier stop") : QString());
+    item->setToolTip(CostColumn, tr("%1, %2 in total over %3 evaluations")
+      .arg(methodName(result.method()))
+      .arg(costString(result.totalCost()))
+      .arg(result.evaluationCount()));
+    }
+
+  QBrush brush = _tree->palette().text();
+  if (result.isStale())
+    {
+    brush = _tree->palette().brush(QPalette::Disabled, QPalette::Text);
+    }
+  else if (result.method() == EvaluationMethod::Failed)
+    {
+    brush = QBrush(Qt::red);
+    }
+
+  for (int i = ValueColumn; i < ColumnCount; ++i)
+    {
+    item->setForeground(i, brush);
+    }
+  _updating = false;
+  }
+
+}
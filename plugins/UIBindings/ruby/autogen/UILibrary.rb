@@ -21,6 +21,9 @@ require_relative 'ChangedNotifier'
 require_relative 'InputNotifier'
 require_relative 'Dockable'
 require_relative 'ModuleExplorerDock'
+require_relative 'ValueTreeDock'
+require_relative 'HexViewDock'
+require_relative 'WatchDock'
 require_relative 'EditableTextWindow'
 require_relative 'Console'
 require_relative 'Terminal'
@@ -8,7 +8,9 @@
 #include "Dockable.h"
 #include "../../LldbDriver/include/Process.h"
 #include "../../LldbDriver/include/Target.h"
+#include "../../LldbDriver/include/SymbolIndex.h"
 #include "FileEditor.h"
+#include "../../LldbDriver/include/Frame.h"
 
 
 using namespace UI;
@@ -119,10 +121,13 @@ struct MainWindow_MainWindow_overload : Reflect::FunctionArgumentCountSelector<
 struct UI_MainWindow_aboutToClose_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< UI::AboutToCloseNotifier *(::UI::MainWindow::*)() >, &::UI::MainWindow::aboutToClose, bondage::FunctionCaller> { };
 struct UI_MainWindow_addConsole_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< UI::Console *(::UI::MainWindow::*)(const QString &, bool) >, &::UI::MainWindow::addConsole, bondage::FunctionCaller> { };
 struct UI_MainWindow_addEditor_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< UI::EditableTextWindow *(::UI::MainWindow::*)(const QString &, bool) >, &::UI::MainWindow::addEditor, bondage::FunctionCaller> { };
+struct UI_MainWindow_addMemoryView_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< UI::HexViewDock *(::UI::MainWindow::*)(const QString &, bool) >, &::UI::MainWindow::addMemoryView, bondage::FunctionCaller> { };
 struct UI_MainWindow_addMenu_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< UI::Menu *(::UI::MainWindow::*)(const QString &) >, &::UI::MainWindow::addMenu, bondage::FunctionCaller> { };
 struct UI_MainWindow_addModuleExplorer_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< UI::Dockable *(::UI::MainWindow::*)(const QString &, bool) >, &::UI::MainWindow::addModuleExplorer, bondage::FunctionCaller> { };
 struct UI_MainWindow_addTerminal_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< UI::Terminal *(::UI::MainWindow::*)(const QString &, bool) >, &::UI::MainWindow::addTerminal, bondage::FunctionCaller> { };
 struct UI_MainWindow_addToolBar_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< UI::ToolBar *(::UI::MainWindow::*)(const QString &) >, &::UI::MainWindow::addToolBar, bondage::FunctionCaller> { };
+struct UI_MainWindow_addValueTree_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< UI::ValueTreeDock *(::UI::MainWindow::*)(const QString &, bool) >, &::UI::MainWindow::addValueTree, bondage::FunctionCaller> { };
+struct UI_MainWindow_addWatches_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< UI::WatchDock *(::UI::MainWindow::*)(const QString &, bool) >, &::UI::MainWindow::addWatches, bondage::FunctionCaller> { };
 struct UI_MainWindow_debugOutput_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< UI::DebugNotifier *(::UI::MainWindow::*)() >, &::UI::MainWindow::debugOutput, bondage::FunctionCaller> { };
 struct UI_MainWindow_editorClosed_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< UI::EditorNotifier *(::UI::MainWindow::*)() >, &::UI::MainWindow::editorClosed, bondage::FunctionCaller> { };
 struct UI_MainWindow_editorOpened_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< UI::EditorNotifier *(::UI::MainWindow::*)() >, &::UI::MainWindow::editorOpened, bondage::FunctionCaller> { };
@@ -147,6 +152,7 @@ struct UI_MainWindow_setGeometry_overload0_t : Reflect::FunctionCall<Reflect::Fu
 struct UI_MainWindow_setProcess_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::UI::MainWindow::*)(const Process::Pointer &) >, &::UI::MainWindow::setProcess, bondage::FunctionCaller> { };
 struct UI_MainWindow_setTarget_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::UI::MainWindow::*)(const Target::Pointer &) >, &::UI::MainWindow::setTarget, bondage::FunctionCaller> { };
 struct UI_MainWindow_showDock_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::UI::MainWindow::*)(UI::Dockable *) >, &::UI::MainWindow::showDock, bondage::FunctionCaller> { };
+struct UI_MainWindow_symbolIndex_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< SymbolIndex::Pointer(::UI::MainWindow::*)() const >, &::UI::MainWindow::symbolIndex, bondage::FunctionCaller> { };
 struct UI_MainWindow_target_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< Target::Pointer(::UI::MainWindow::*)() const >, &::UI::MainWindow::target, bondage::FunctionCaller> { };
 struct UI_MainWindow_tr_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< QString(*)(const char *) >, &UI_MainWindow_tr_overload0, bondage::FunctionCaller> { };
 struct UI_MainWindow_tr_overload1_t : Reflect::FunctionCall<Reflect::FunctionSignature< QString(*)(const char *, const char *, int) >, &::UI::MainWindow::tr, bondage::FunctionCaller> { };
@@ -185,6 +191,9 @@ const bondage::Function UI_MainWindow_methods[] = {
   bondage::FunctionBuilder::build<
     UI_MainWindow_addEditor_overload0_t
     >("addEditor"),
+  bondage::FunctionBuilder::build<
+    UI_MainWindow_addMemoryView_overload0_t
+    >("addMemoryView"),
   bondage::FunctionBuilder::build<
     UI_MainWindow_addMenu_overload0_t
     >("addMenu"),
@@ -197,6 +206,12 @@ const bondage::Function UI_MainWindow_methods[] = {
   bondage::FunctionBuilder::build<
     UI_MainWindow_addToolBar_overload0_t
     >("addToolBar"),
+  bondage::FunctionBuilder::build<
+    UI_MainWindow_addValueTree_overload0_t
+    >("addValueTree"),
+  bondage::FunctionBuilder::build<
+    UI_MainWindow_addWatches_overload0_t
+    >("addWatches"),
   bondage::FunctionBuilder::build<
     UI_MainWindow_debugOutput_overload0_t
     >("debugOutput"),
@@ -234,6 +249,9 @@ const bondage::Function UI_MainWindow_methods[] = {
   bondage::FunctionBuilder::build<
     UI_MainWindow_showDock_overload0_t
     >("showDock"),
+  bondage::FunctionBuilder::build<
+    UI_MainWindow_symbolIndex_overload0_t
+    >("symbolIndex"),
   bondage::FunctionBuilder::build<
     UI_MainWindow_target_overload0_t
     >("target"),
@@ -252,7 +270,7 @@ BONDAGE_IMPLEMENT_EXPOSED_CLASS(
   MainWindow,
   ::QMainWindow,
   UI_MainWindow_methods,
-  25);
+  29);
 
 
 
@@ -583,6 +601,7 @@ struct UI_FileEditor_focusOnLine_overload0_t : Reflect::FunctionCall<Reflect::Fu
 struct UI_FileEditor_makeKey_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< QString(*)(const QString &) >, &::UI::FileEditor::makeKey, bondage::FunctionCaller> { };
 struct UI_FileEditor_marginClicked_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< UI::MarginClickNotifier *(::UI::FileEditor::*)() >, &::UI::FileEditor::marginClicked, bondage::FunctionCaller> { };
 struct UI_FileEditor_removeMarker_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::UI::FileEditor::*)(UI::FileEditor::MarkerType, size_t) >, &::UI::FileEditor::removeMarker, bondage::FunctionCaller> { };
+struct UI_FileEditor_setMarkers_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::UI::FileEditor::*)(UI::FileEditor::MarkerType, const Eks::Vector<size_t> &) >, &::UI::FileEditor::setMarkers, bondage::FunctionCaller> { };
 struct UI_FileEditor_tr_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< QString(*)(const char *) >, &UI_FileEditor_tr_overload0, bondage::FunctionCaller> { };
 struct UI_FileEditor_tr_overload1_t : Reflect::FunctionCall<Reflect::FunctionSignature< QString(*)(const char *, const char *, int) >, &::UI::FileEditor::tr, bondage::FunctionCaller> { };
 struct FileEditor_tr_overload_1 : Reflect::FunctionArgCountSelectorBlock<1,
@@ -627,6 +646,9 @@ const bondage::Function UI_FileEditor_methods[] = {
   bondage::FunctionBuilder::build<
     UI_FileEditor_removeMarker_overload0_t
     >("removeMarker"),
+  bondage::FunctionBuilder::build<
+    UI_FileEditor_setMarkers_overload0_t
+    >("setMarkers"),
   bondage::FunctionBuilder::buildOverload< FileEditor_tr_overload >("tr"),
   bondage::FunctionBuilder::buildOverload< FileEditor_trUtf8_overload >("trUtf8")
 };
@@ -639,7 +661,7 @@ BONDAGE_IMPLEMENT_EXPOSED_CLASS(
   FileEditor,
   ::UI::Editor,
   UI_FileEditor_methods,
-  8);
+  9);
 
 
 
@@ -942,6 +964,227 @@ BONDAGE_IMPLEMENT_EXPOSED_CLASS(
 
 
 
+// Exposing class ::UI::ValueTreeDock
+QString UI_ValueTreeDock_tr_overload0(const char * inputArg0)
+{
+  auto result = ::UI::ValueTreeDock::tr(std::forward<const char *>(inputArg0));
+  return result;
+}
+
+QString UI_ValueTreeDock_trUtf8_overload0(const char * inputArg0)
+{
+  auto result = ::UI::ValueTreeDock::trUtf8(std::forward<const char *>(inputArg0));
+  return result;
+}
+
+struct UI_ValueTreeDock_clear_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::UI::ValueTreeDock::*)() >, &::UI::ValueTreeDock::clear, bondage::FunctionCaller> { };
+struct UI_ValueTreeDock_setFrame_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::UI::ValueTreeDock::*)(const LldbDriver::Frame &) >, &::UI::ValueTreeDock::setFrame, bondage::FunctionCaller> { };
+struct UI_ValueTreeDock_setRunning_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::UI::ValueTreeDock::*)(bool) >, &::UI::ValueTreeDock::setRunning, bondage::FunctionCaller> { };
+struct UI_ValueTreeDock_tr_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< QString(*)(const char *) >, &UI_ValueTreeDock_tr_overload0, bondage::FunctionCaller> { };
+struct UI_ValueTreeDock_tr_overload1_t : Reflect::FunctionCall<Reflect::FunctionSignature< QString(*)(const char *, const char *, int) >, &::UI::ValueTreeDock::tr, bondage::FunctionCaller> { };
+struct ValueTreeDock_tr_overload_1 : Reflect::FunctionArgCountSelectorBlock<1,
+      UI_ValueTreeDock_tr_overload0_t
+      > { };
+struct ValueTreeDock_tr_overload_3 : Reflect::FunctionArgCountSelectorBlock<3,
+      UI_ValueTreeDock_tr_overload1_t
+      > { };
+struct ValueTreeDock_tr_overload : Reflect::FunctionArgumentCountSelector<
+    ValueTreeDock_tr_overload_1,
+    ValueTreeDock_tr_overload_3
+    > { };
+struct UI_ValueTreeDock_trUtf8_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< QString(*)(const char *) >, &UI_ValueTreeDock_trUtf8_overload0, bondage::FunctionCaller> { };
+struct UI_ValueTreeDock_trUtf8_overload1_t : Reflect::FunctionCall<Reflect::FunctionSignature< QString(*)(const char *, const char *, int) >, &::UI::ValueTreeDock::trUtf8, bondage::FunctionCaller> { };
+struct ValueTreeDock_trUtf8_overload_1 : Reflect::FunctionArgCountSelectorBlock<1,
+      UI_ValueTreeDock_trUtf8_overload0_t
+      > { };
+struct ValueTreeDock_trUtf8_overload_3 : Reflect::FunctionArgCountSelectorBlock<3,
+      UI_ValueTreeDock_trUtf8_overload1_t
+      > { };
+struct ValueTreeDock_trUtf8_overload : Reflect::FunctionArgumentCountSelector<
+    ValueTreeDock_trUtf8_overload_1,
+    ValueTreeDock_trUtf8_overload_3
+    > { };
+
+const bondage::Function UI_ValueTreeDock_methods[] = {
+  bondage::FunctionBuilder::build<
+    UI_ValueTreeDock_clear_overload0_t
+    >("clear"),
+  bondage::FunctionBuilder::build<
+    UI_ValueTreeDock_setFrame_overload0_t
+    >("setFrame"),
+  bondage::FunctionBuilder::build<
+    UI_ValueTreeDock_setRunning_overload0_t
+    >("setRunning"),
+  bondage::FunctionBuilder::buildOverload< ValueTreeDock_tr_overload >("tr"),
+  bondage::FunctionBuilder::buildOverload< ValueTreeDock_trUtf8_overload >("trUtf8")
+};
+
+
+BONDAGE_IMPLEMENT_EXPOSED_CLASS(
+  UI_ValueTreeDock,
+  g_bondage_library_UI,
+  ::UI,
+  ValueTreeDock,
+  ::UI::Dockable,
+  UI_ValueTreeDock_methods,
+  5);
+
+
+
+// Exposing class ::UI::HexViewDock
+QString UI_HexViewDock_tr_overload0(const char * inputArg0)
+{
+  auto result = ::UI::HexViewDock::tr(std::forward<const char *>(inputArg0));
+  return result;
+}
+
+QString UI_HexViewDock_trUtf8_overload0(const char * inputArg0)
+{
+  auto result = ::UI::HexViewDock::trUtf8(std::forward<const char *>(inputArg0));
+  return result;
+}
+
+struct UI_HexViewDock_address_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< uint64_t(::UI::HexViewDock::*)() const >, &::UI::HexViewDock::address, bondage::FunctionCaller> { };
+struct UI_HexViewDock_clear_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::UI::HexViewDock::*)() >, &::UI::HexViewDock::clear, bondage::FunctionCaller> { };
+struct UI_HexViewDock_setAddress_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::UI::HexViewDock::*)(uint64_t) >, &::UI::HexViewDock::setAddress, bondage::FunctionCaller> { };
+struct UI_HexViewDock_setProcess_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::UI::HexViewDock::*)(const Process::Pointer &) >, &::UI::HexViewDock::setProcess, bondage::FunctionCaller> { };
+struct UI_HexViewDock_tr_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< QString(*)(const char *) >, &UI_HexViewDock_tr_overload0, bondage::FunctionCaller> { };
+struct UI_HexViewDock_tr_overload1_t : Reflect::FunctionCall<Reflect::FunctionSignature< QString(*)(const char *, const char *, int) >, &::UI::HexViewDock::tr, bondage::FunctionCaller> { };
+struct HexViewDock_tr_overload_1 : Reflect::FunctionArgCountSelectorBlock<1,
+      UI_HexViewDock_tr_overload0_t
+      > { };
+struct HexViewDock_tr_overload_3 : Reflect::FunctionArgCountSelectorBlock<3,
+      UI_HexViewDock_tr_overload1_t
+      > { };
+struct HexViewDock_tr_overload : Reflect::FunctionArgumentCountSelector<
+    HexViewDock_tr_overload_1,
+    HexViewDock_tr_overload_3
+    > { };
+struct UI_HexViewDock_trUtf8_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< QString(*)(const char *) >, &UI_HexViewDock_trUtf8_overload0, bondage::FunctionCaller> { };
+struct UI_HexViewDock_trUtf8_overload1_t : Reflect::FunctionCall<Reflect::FunctionSignature< QString(*)(const char *, const char *, int) >, &::UI::HexViewDock::trUtf8, bondage::FunctionCaller> { };
+struct HexViewDock_trUtf8_overload_1 : Reflect::FunctionArgCountSelectorBlock<1,
+      UI_HexViewDock_trUtf8_overload0_t
+      > { };
+struct HexViewDock_trUtf8_overload_3 : Reflect::FunctionArgCountSelectorBlock<3,
+      UI_HexViewDock_trUtf8_overload1_t
+      > { };
+struct HexViewDock_trUtf8_overload : Reflect::FunctionArgumentCountSelector<
+    HexViewDock_trUtf8_overload_1,
+    HexViewDock_trUtf8_overload_3
+    > { };
+
+const bondage::Function UI_HexViewDock_methods[] = {
+  bondage::FunctionBuilder::build<
+    UI_HexViewDock_address_overload0_t
+    >("address"),
+  bondage::FunctionBuilder::build<
+    UI_HexViewDock_clear_overload0_t
+    >("clear"),
+  bondage::FunctionBuilder::build<
+    UI_HexViewDock_setAddress_overload0_t
+    >("setAddress"),
+  bondage::FunctionBuilder::build<
+    UI_HexViewDock_setProcess_overload0_t
+    >("setProcess"),
+  bondage::FunctionBuilder::buildOverload< HexViewDock_tr_overload >("tr"),
+  bondage::FunctionBuilder::buildOverload< HexViewDock_trUtf8_overload >("trUtf8")
+};
+
+
+BONDAGE_IMPLEMENT_EXPOSED_CLASS(
+  UI_HexViewDock,
+  g_bondage_library_UI,
+  ::UI,
+  HexViewDock,
+  ::UI::Dockable,
+  UI_HexViewDock_methods,
+  6);
+
+
+
+// Exposing class ::UI::WatchDock
+QString UI_WatchDock_tr_overload0(const char * inputArg0)
+{
+  auto result = ::UI::WatchDock::tr(std::forward<const char *>(inputArg0));
+  return result;
+}
+
+QString UI_WatchDock_trUtf8_overload0(const char * inputArg0)
+{
+  auto result = ::UI::WatchDock::trUtf8(std::forward<const char *>(inputArg0));
+  return result;
+}
+
+struct UI_WatchDock_addWatch_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::UI::WatchDock::*)(const QString &) >, &::UI::WatchDock::addWatch, bondage::FunctionCaller> { };
+struct UI_WatchDock_clear_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::UI::WatchDock::*)() >, &::UI::WatchDock::clear, bondage::FunctionCaller> { };
+struct UI_WatchDock_clearWatches_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::UI::WatchDock::*)() >, &::UI::WatchDock::clearWatches, bondage::FunctionCaller> { };
+struct UI_WatchDock_evaluate_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::UI::WatchDock::*)(const LldbDriver::Frame &) >, &::UI::WatchDock::evaluate, bondage::FunctionCaller> { };
+struct UI_WatchDock_setRunning_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< void(::UI::WatchDock::*)(bool) >, &::UI::WatchDock::setRunning, bondage::FunctionCaller> { };
+struct UI_WatchDock_watchCount_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< size_t(::UI::WatchDock::*)() const >, &::UI::WatchDock::watchCount, bondage::FunctionCaller> { };
+struct UI_WatchDock_watchExpression_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< QString(::UI::WatchDock::*)(size_t) const >, &::UI::WatchDock::watchExpression, bondage::FunctionCaller> { };
+struct UI_WatchDock_tr_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< QString(*)(const char *) >, &UI_WatchDock_tr_overload0, bondage::FunctionCaller> { };
+struct UI_WatchDock_tr_overload1_t : Reflect::FunctionCall<Reflect::FunctionSignature< QString(*)(const char *, const char *, int) >, &::UI::WatchDock::tr, bondage::FunctionCaller> { };
+struct WatchDock_tr_overload_1 : Reflect::FunctionArgCountSelectorBlock<1,
+      UI_WatchDock_tr_overload0_t
+      > { };
+struct WatchDock_tr_overload_3 : Reflect::FunctionArgCountSelectorBlock<3,
+      UI_WatchDock_tr_overload1_t
+      > { };
+struct WatchDock_tr_overload : Reflect::FunctionArgumentCountSelector<
+    WatchDock_tr_overload_1,
+    WatchDock_tr_overload_3
+    > { };
+struct UI_WatchDock_trUtf8_overload0_t : Reflect::FunctionCall<Reflect::FunctionSignature< QString(*)(const char *) >, &UI_WatchDock_trUtf8_overload0, bondage::FunctionCaller> { };
+struct UI_WatchDock_trUtf8_overload1_t : Reflect::FunctionCall<Reflect::FunctionSignature< QString(*)(const char *, const char *, int) >, &::UI::WatchDock::trUtf8, bondage::FunctionCaller> { };
+struct WatchDock_trUtf8_overload_1 : Reflect::FunctionArgCountSelectorBlock<1,
+      UI_WatchDock_trUtf8_overload0_t
+      > { };
+struct WatchDock_trUtf8_overload_3 : Reflect::FunctionArgCountSelectorBlock<3,
+      UI_WatchDock_trUtf8_overload1_t
+      > { };
+struct WatchDock_trUtf8_overload : Reflect::FunctionArgumentCountSelector<
+    WatchDock_trUtf8_overload_1,
+    WatchDock_trUtf8_overload_3
+    > { };
+
+const bondage::Function UI_WatchDock_methods[] = {
+  bondage::FunctionBuilder::build<
+    UI_WatchDock_addWatch_overload0_t
+    >("addWatch"),
+  bondage::FunctionBuilder::build<
+    UI_WatchDock_clear_overload0_t
+    >("clear"),
+  bondage::FunctionBuilder::build<
+    UI_WatchDock_clearWatches_overload0_t
+    >("clearWatches"),
+  bondage::FunctionBuilder::build<
+    UI_WatchDock_evaluate_overload0_t
+    >("evaluate"),
+  bondage::FunctionBuilder::build<
+    UI_WatchDock_setRunning_overload0_t
+    >("setRunning"),
+  bondage::FunctionBuilder::build<
+    UI_WatchDock_watchCount_overload0_t
+    >("watchCount"),
+  bondage::FunctionBuilder::build<
+    UI_WatchDock_watchExpression_overload0_t
+    >("watchExpression"),
+  bondage::FunctionBuilder::buildOverload< WatchDock_tr_overload >("tr"),
+  bondage::FunctionBuilder::buildOverload< WatchDock_trUtf8_overload >("trUtf8")
+};
+
+
+BONDAGE_IMPLEMENT_EXPOSED_CLASS(
+  UI_WatchDock,
+  g_bondage_library_UI,
+  ::UI,
+  WatchDock,
+  ::UI::Dockable,
+  UI_WatchDock_methods,
+  9);
+
+
+
 // Exposing class ::UI::EditableTextWindow
 ::UI::EditableTextWindow * UI_EditableTextWindow_EditableTextWindow_overload0(bool inputArg0)
 {
@@ -1274,6 +1517,10 @@ const bondage::WrappedClass *UI_QWidget_caster(const void *vPtr)
   {
     return &UI_Terminal;
   }
+  if (Crate::CastHelper< ::QWidget, ::UI::ValueTreeDock >::canCast(ptr))
+  {
+    return &UI_ValueTreeDock;
+  }
   if (Crate::CastHelper< ::QWidget, ::UI::ModuleExplorerDock >::canCast(ptr))
   {
     return &UI_ModuleExplorerDock;
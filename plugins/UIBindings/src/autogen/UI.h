@@ -12,6 +12,9 @@
 #include "Console.h"
 #include "Dockable.h"
 #include "ModuleExplorer.h"
+#include "ValueTree.h"
+#include "HexView.h"
+#include "WatchView.h"
 #include "Terminal.h"
 #include "ToolBar.h"
 #include "Application.h"
@@ -49,6 +52,9 @@ BONDAGE_EXPOSED_CLASS_UNMANAGED(EXPORT_DEBUGIFY, ::UI::ChangedNotifier)
 BONDAGE_EXPOSED_CLASS_UNMANAGED(EXPORT_DEBUGIFY, ::UI::InputNotifier)
 BONDAGE_EXPOSED_CLASS_DERIVED_UNMANAGED(EXPORT_DEBUGIFY, ::UI::Dockable, ::QDockWidget, ::QWidget)
 BONDAGE_EXPOSED_CLASS_DERIVED_MANAGED(EXPORT_DEBUGIFY, ::UI::ModuleExplorerDock, ::UI::Dockable, ::QWidget)
+BONDAGE_EXPOSED_CLASS_DERIVED_MANAGED(EXPORT_DEBUGIFY, ::UI::ValueTreeDock, ::UI::Dockable, ::QWidget)
+BONDAGE_EXPOSED_CLASS_DERIVED_MANAGED(EXPORT_DEBUGIFY, ::UI::HexViewDock, ::UI::Dockable, ::QWidget)
+BONDAGE_EXPOSED_CLASS_DERIVED_MANAGED(EXPORT_DEBUGIFY, ::UI::WatchDock, ::UI::Dockable, ::QWidget)
 BONDAGE_EXPOSED_CLASS_DERIVED_MANAGED(EXPORT_DEBUGIFY, ::UI::EditableTextWindow, ::UI::Dockable, ::QWidget)
 BONDAGE_EXPOSED_CLASS_DERIVED_MANAGED(EXPORT_DEBUGIFY, ::UI::Console, ::UI::Dockable, ::QWidget)
 BONDAGE_EXPOSED_CLASS_DERIVED_MANAGED(EXPORT_DEBUGIFY, ::UI::Terminal, ::UI::Console, ::QWidget)
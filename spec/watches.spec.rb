@@ -0,0 +1,108 @@
+require_relative 'helper'
+require 'Watches'
+
+class FakeNotifier
+  def listen(&block)
+    (@listeners ||= []) << block
+  end
+end
+
+class FakeWatchDock
+  attr_reader :watches
+
+  def initialize()
+    @watches = []
+  end
+
+  def addWatch(expression)
+    @watches << expression
+  end
+
+  def clearWatches()
+    @watches.clear
+  end
+
+  def watchCount()
+    return @watches.length
+  end
+
+  def watchExpression(i)
+    return @watches[i]
+  end
+end
+
+class FakeMainWindow
+  attr_reader :dock
+
+  def addWatches(name, toolbar)
+    @dock = FakeWatchDock.new
+    return @dock
+  end
+end
+
+class FakeDebugger
+  attr_reader :ready, :notReady, :processEnd
+
+  def initialize()
+    @ready = FakeNotifier.new
+    @notReady = FakeNotifier.new
+    @processEnd = FakeNotifier.new
+  end
+end
+
+class FakeProject
+  def initialize(values)
+    @values = values
+  end
+
+  def install_handler(id, handler)
+    handler.deserialise(self)
+  end
+
+  def has_value(key)
+    return @values.include?(key)
+  end
+
+  def value(key)
+    return @values[key]
+  end
+
+  def has_location(id)
+    return true
+  end
+
+  def set_value(key, value, location)
+    @values[key] = value
+  end
+end
+
+describe App::Watches do
+  it 'loads watches from the project' do
+    window = FakeMainWindow.new
+    described_class.new(window, FakeDebugger.new, FakeProject.new({ :watches => [ "a", "b.c" ] }))
+
+    expect(window.dock.watches).to eq([ "a", "b.c" ])
+  end
+
+  it 'replaces watches when the project is reloaded' do
+    window = FakeMainWindow.new
+    watches = described_class.new(window, FakeDebugger.new, FakeProject.new({ :watches => [ "a", "b.c" ] }))
+
+    watches.deserialise(FakeProject.new({ :watches => [ "x" ] }))
+    expect(window.dock.watches).to eq([ "x" ])
+
+    watches.deserialise(FakeProject.new({ }))
+    expect(window.dock.watches).to eq([])
+  end
+
+  it 'saves watches to the project' do
+    window = FakeMainWindow.new
+    watches = described_class.new(window, FakeDebugger.new, FakeProject.new({ }))
+    window.dock.addWatch("i")
+    window.dock.addWatch("p->next")
+
+    project = FakeProject.new({ })
+    watches.serialise(project)
+    expect(project.value(:watches)).to eq([ "i", "p->next" ])
+  end
+end